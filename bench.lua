@@ -0,0 +1,78 @@
+assert(package.loadlib(assert(package.searchpath("SDL2", package.cpath)), "*"))
+
+local c = require "rogue.core"
+
+-- lua bench.lua [width] [height] [threads] [backend] [kernel]
+local width = tonumber(arg[1]) or 320
+local height = tonumber(arg[2]) or 120
+
+c.init {
+	title = "bench",
+	width = width,
+	height = height,
+	fps = 100000,	-- don't wait
+	threads = tonumber(arg[3]) or 1,
+	backend = arg[4] or "surface",
+	kernel = arg[5],
+}
+
+local sprites = {}
+
+local function random_sprite()
+	local w = math.random(1, 60)
+	local h = math.random(1, 30)
+	local lines = {}
+	for i = 1, h do
+		local line = {}
+		for j = 1, w do
+			line[j] = math.random() < 0.2 and "." or string.char(math.random(33, 126))
+		end
+		lines[i] = table.concat(line)
+	end
+	lines.color = math.random(0, 0xffffff)
+	lines.background = math.random(0, 0xffffff)
+	lines.transparency = "."
+	lines.layer = math.random(0, 7)
+	local s = c.sprite(lines)
+	s:setpos(math.random(0, width), math.random(0, height))
+	return s
+end
+
+for i = 1, 300 do
+	sprites[i] = random_sprite()
+end
+
+local function bench(name, n, move, batch)
+	local t = os.clock()
+	for i = 1, n do
+		c.event()
+		if move then
+			for j = 1, move do
+				local s = sprites[math.random(#sprites)]
+				s:setpos(math.random(0, width), math.random(0, height))
+			end
+		end
+		if batch then
+			batch()
+		end
+		c.frame()
+	end
+	print(string.format("%s : %.3f ms per frame", name, (os.clock() - t) * 1000 / n))
+end
+
+local coords = {}
+
+local function move_all()
+	for j = 1, #sprites do
+		coords[j*2-1] = math.random(0, width)
+		coords[j*2] = math.random(0, height)
+	end
+	c.setpos_many(sprites, coords)
+end
+
+print(string.format("%dx%d kernel %s", width, height, c.stat().kernel))
+
+bench("static", 300)
+bench("move 30 sprites", 300, 30)
+bench("move all sprites", 300, #sprites)
+bench("move all sprites by setpos_many", 300, nil, move_all)
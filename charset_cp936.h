@@ -1,3 +1,5 @@
+#ifdef CHARSET_UNICODE
+
 // All GBK/CP936 charset
 static const int16_t unimap_cp936[] = {
 0x00a4,0x00a7,0x00a8,0x00b0,0x00b1,0x00b7,0x00d7,0x00e0,0x00e1,0x00e8,0x00e9,0x00ea,0x00ec,0x00ed,0x00f2,0x00f3,
@@ -468,6 +470,8 @@ static const int16_t unimap_cp936[] = {
 0xff5e,0xffe0,0xffe1,0xffe3,0xffe5,
 };
 
+#endif
+
 // The font bitmap is from https://timothyqiu.itch.io/vonwaon-bitmap
 static const uint8_t uni12x12_cp936[] = {
 0x80,0x08,0x4c,0x90,0x30,0x60,0x20,0x20,0x40,0x10,0x40,0x10,0x40,0x10,0x20,0x20,0x30,0x60,0x4c,0x90,0x80,0x08,0x00,0x00,
@@ -3,30 +3,118 @@
 #include <lua.h>
 #include <lauxlib.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "SDL.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 #include "charset_cp437.h"
 #include "charset_cp936.h"
+#include "unimap.h"
 
-#define FRAMESEC 1000
-#define PIXELWIDTH 6
-#define PIXELHEIGHT 12
+#define SPINTIME 2	// ms, the default spin option
+#define FRAMESTAT 256	// the frame times kept for the stat
+#define MAXCELLW 12	// the cell sizes, see cell_kernels
+#define MAXCELLH 24
 #define TABSIZE 8
-#define UNICACHE 1024
 #define BACKLAYER 255
+#define GLYPHCACHE 256
+#define TILEROWS 8
+#define MAXTHREAD 64
+#define TILE_DRAW 0	// the jobs of the tiles, see run_tile
+#define TILE_COMPOSE 1
+#define TILE_FLUSH 2
+#define MAXZOOM 8
+#define CELLSHIFT 5
+#define CELLSIZE (1 << CELLSHIFT)
+#define SPRITEGRID 64
+#define POOLED -1	// the bucket of the sprites in the pool
+#define SPRITE_FREE 0
+#define SPRITE_HIDDEN 1
+#define SPRITE_VISIBLE 2
+#define COVER_GLYPH 1
+#define COVER_BACKGROUND 2
+#define COVER_FULL (COVER_GLYPH | COVER_BACKGROUND)
+#define MAPCHUNK 64
+#define MAPALIGN 4096
+#define MAPRESIDENT 1024
+// An expanded glyph is padded to 32 bytes for the vector kernels, 4 bytes per pixel at most
+#define GLYPHBLOCK ((MAXCELLW * MAXCELLH * 4 + 31) & ~31)
+#define GLYPHCHUNK (GLYPHBLOCK / 8)
+#define GLYPHBITS ((MAXCELLW * MAXCELLH + 7) / 8 + 2)
+
+#if defined(__GNUC__)
+#define FORCEINLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define FORCEINLINE __forceinline
+#else
+#define FORCEINLINE inline
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define RASTER_X86
+#include <immintrin.h>
+#if defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define RASTER_NEON
+#include <arm_neon.h>
+#endif
 
 struct slot {
 	uint16_t background;	// 565 RGB
 	uint16_t color;		// 565 RGB
 	uint32_t code:23;	// for unicode
 	uint32_t rightpart:1;
-	uint32_t layer:8;
+};
+
+// The slots of the screen in planes, so the rows can be composed and compared with wide loads
+struct slotbuffer {
+	uint32_t *code;	// code | rightpart << 23
+	uint16_t *color;
+	uint16_t *background;
+};
+
+// An opaque run of slots in a row of a sparse body
+struct span {
+	uint16_t x;
+	uint16_t n;
+	uint32_t slot;	// the index of the first slot in body->s
+};
+
+// The slots of a sprite. A dense body stores all the w * h slots in rows,
+// a sparse one stores only the opaque runs, the transparent slots are skipped outright.
+struct body {
+	int ref;	// the number of sprites sharing the body, it's copied on write if shared
+	int sparse;
+	int n;	// the number of slots in s
+	int h;
+	int nspan;
+	uint16_t color;	// of the transparent slots, for text()
+	uint16_t background;
+	uint64_t text;	// the hash of the text set by text(), 0 if the slots are not from a text
+	uint32_t *row;	// sparse only, the first span of each row, h + 1 entries
+	struct span *span;	// sparse only
+	struct slot s[1];
 };
 
 struct sprite {
-	struct sprite *prev;
+	struct sprite *prev;	// the bucket of the spatial index, NULL if invisible
 	struct sprite *next;
+	int bucket;
+	int layer;
+	uint64_t serial;	// the sprites on the same layer are drawn in the order of creation
 	unsigned w;
 	unsigned h;
 	int x;
@@ -34,21 +122,175 @@ struct sprite {
 	int kx;
 	int ky;
 	int background;
-	struct slot s[1];
+	int tint;	// the color of all the glyphs, -1 uses the colors of the body
+	struct body *body;	// uservalue 1 of the sprite, may be shared by the clones
+};
+
+// A sprite culled on the camera, order is layer << 56 | serial
+struct culled {
+	struct sprite *spr;
+	uint64_t order;
+};
+
+// A read only file mapped into memory
+struct filemap {
+	const uint8_t *data;
+	size_t size;
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#endif
+};
+
+// A chunked map file (see mapfile_header) mapped into memory, only the chunks around the camera are resident
+struct mapfile {
+	struct mapfile *prev;	// NULL if invisible
+	struct mapfile *next;
+	int x;
+	int y;
+	int width;	// in slots
+	int height;
+	int chunk_w;
+	int chunk_h;
+	int chunks_x;	// the number of chunks in a row
+	int chunks_y;
+	size_t chunk_bytes;
+	int prefetch;
+	int resident[4];	// the chunks [x0, x1) * [y0, y1) around the camera
+	struct filemap map;
+	const uint64_t *index;	// the offsets of the chunks, 0 for an empty one
+};
+
+struct glyph {
+	uint64_t key;
+	struct glyph *prev;	// lru list
+	struct glyph *next;
+	struct glyph *hash_next;
+	uint8_t pixel[1];	// raster.block bytes
+};
+
+struct glyph_cache {
+	int size;
+	int n;
+	int stride;	// the size of a glyph with its pixels
+	int hash_bits;
+	uint64_t hit;
+	uint64_t miss;
+	struct glyph *lru;	// the most recently used one, lru->prev is the least
+	struct glyph **hash;
+	struct glyph *g;
+};
+
+struct raster;
+typedef void (*expand_func)(const struct raster *r, uint8_t *p, const struct slot *s);
+typedef void (*flush_func)(struct glyph_cache *c, const struct raster *r, uint8_t *p, int pitch, struct slotbuffer s, struct slotbuffer last, int w, int h, int dirty, uint8_t *changed);
+
+// The vector kernels handle a glyph block 8 bytes a chunk, each byte of a chunk tests one bit of an 8 pixels window
+// The glyphs of the narrow slots (code <= 255) and the wide ones (256 + index), cell_h rows of pitch bytes,
+// a row is in the highest bits. The built-in fonts, or the PSF2 files mapped into memory.
+struct font {
+	const uint8_t *narrow;
+	const uint8_t *wide;
+	int narrow_n;
+	int wide_n;
+	int narrow_size;	// bytes per glyph
+	int wide_size;
+	int narrow_pitch;	// bytes per row
+	int wide_pitch;
+	int wide_shift;	// the right part starts at this bit of the row
+	const uint8_t *page;	// the unicode map, the glyph of unicode u is block[page[u >> 8]][u & 0xff]
+	const uint16_t (*block)[256];
+	struct filemap file[2];	// narrow and wide
+};
+
+struct raster {
+	const char *name;
+	const struct font *font;
+	expand_func expand;
+	flush_func flush;
+	int bpp;	// 1: RGB332 indexed, 2: RGB565, 3: 24bits RGB, 4: XRGB8888
+	int vector;	// a vector kernel is chosen, the composition uses the vector compares too
+	int zoom;	// integer scale factor of the glyphs
+	int cell_w;	// the glyph size in pixels
+	int cell_h;
+	int block;	// the bytes of an expanded glyph
+	int chunks;
+	uint16_t q[GLYPHCHUNK];	// the first pixel of the window
+	uint8_t phase[GLYPHCHUNK];	// which pattern of the pixel color
+	uint64_t sel[GLYPHCHUNK];	// the bit for each byte
+};
+
+struct context;
+static void run_tile(struct context *ctx, struct glyph_cache *c, int job, int tile);
+
+struct pool;
+
+struct worker {
+	struct pool *pool;
+	SDL_Thread *thread;
+	SDL_sem *start;
+	struct glyph_cache *cache;
+	SDL_atomic_t next;	// the next tile in the range of this worker
+	int end;
+};
+
+// Worker 0 is the main thread, the others steal tiles from the ranges of the busy ones
+struct pool {
+	struct context *ctx;
+	int job;	// TILE_DRAW, TILE_COMPOSE or TILE_FLUSH
+	int n;
+	int quit;
+	SDL_sem *done;
+	struct worker w[1];
+};
+
+// A frame being drawn, the slots s are drawn into pixels (the rows from [from, to) of the screen)
+struct frame {
+	struct slotbuffer s;
+	struct slotbuffer last;
+	uint8_t *pixels;
+	int pitch;
+	int from;
+	int to;
+	int dirty;
+};
+
+// The render thread draws and the main thread presents the last frame, while lua simulates the next one
+struct pipeline {
+	SDL_Thread *thread;
+	SDL_sem *start;
+	SDL_sem *done;
+	int quit;
+	int busy;
 };
 
-struct unicode_cache {
-	int unicode[UNICACHE];
-	uint16_t index[UNICACHE];
+// The sprites allocated by integer handles (index + 1) from c.spawn. The headers are in one array,
+// they aren't in the spatial index, the visible ones are culled by walking the array.
+struct spritepool {
+	struct sprite *sprite;
+	uint8_t *state;	// SPRITE_FREE, SPRITE_HIDDEN or SPRITE_VISIBLE
+	int *free;	// the stack of the released handles
+	int cap;
+	int nfree;
+	int top;	// the sprites after top are never used
 };
 
 struct context {
 	SDL_Renderer *renderer;
+	SDL_Texture *texture;	// for the texture backend
 	SDL_Window *window;
-	SDL_Surface *surface;
-	uint64_t tick;
+	SDL_Surface *surface;	// for the scaled or format mismatched window
+	SDL_Surface *target;	// the surface drawn last frame
+	SDL_Surface *window_surface;
+	uint32_t format;
+	uint64_t tick;	// the performance counter of frame 0, the deadline of frame n is tick + n * freq / fps
+	uint64_t last_tick;	// the performance counter at the end of the last frame
 	int frame;
 	int fps;
+	int spin;	// ms, yield instead of sleeping at the end of a frame, SDL_Delay may oversleep
+	int missed;	// the frames finished after the deadline
+	unsigned frame_n;
+	uint32_t frame_time[FRAMESTAT];	// in microseconds, a ring buffer of the last frames
 	int x;
 	int y;
 	int width;	// grid
@@ -57,96 +299,48 @@ struct context {
 	int h;
 	int mousex;
 	int mousey;
-	struct slot *s;
-	struct sprite *spr;
+	int dirty;	// redraw the whole screen next frame
+	struct slotbuffer s;
+	struct slotbuffer last;	// slots of the last frame
+	struct slotbuffer spare;	// the third slots for the pipeline
+	SDL_Rect *rects;	// changed row bands
+	uint8_t *changed;	// changed rows
+	uint8_t *cover;	// the coverage of each slot for the top-down composition
+	int topdown;
+	SDL_atomic_t cell_writes;	// the glyphs written by the composition of this frame
+	SDL_atomic_t overdraw;	// the glyphs covered by upper sprites
+	struct frame f;
+	struct pipeline pipeline;
+	int tile_rows;
+	struct pool *pool;
+	struct glyph_cache *cache;
+	struct raster raster;
+	struct sprite **visible;	// the sprites on the camera this frame, in painter's order
+	struct culled *culled;	// the sprites on the camera in the order of the spatial index, it's sorted into visible if changed
+	int visible_n;
+	int visible_cap;
+	int culled_n;
+	int reorder;	// the culled sprites changed
+	uint64_t serial;	// the serial number of the next sprite
 	uint8_t layer[256];
-	struct unicode_cache u;
+	// The spatial index, a sprite is in the bucket of its top left corner (wrapped in a grid of SPRITEGRID * SPRITEGRID cells),
+	// the larger sprites than a cell are in the last bucket.
+	struct sprite *bucket[SPRITEGRID * SPRITEGRID + 1];
+	struct spritepool sprites;
+	struct body *scratch;	// the slots decoded by the sprite parser
+	struct font font;	// the font files, see init_font
+	int scratch_cap;
+	struct sprite *tilemap;	// the tilemaps under all the sprites, in the order of creation
+	struct mapfile *mapfile;	// the map files under all the tilemaps
 };
 
+// The two level page table generated by unimap.c, see unimap.h
 static inline int
-inthash(int p) {
-	int h = (2654435761 * p) % UNICACHE;
-	return h;
-}
-
-static int
-search_cp437(int unicode) {
-	static const uint16_t cp437_unicode[] = {
-		0x00a0,0x00a1,0x00a2,0x00a3,0x00a5,0x00a7,0x00aa,0x00ab,0x00ac,0x00b0,0x00b1,0x00b2,0x00b5,0x00b6,0x00b7,0x00ba,
-		0x00bb,0x00bc,0x00bd,0x00bf,0x00c4,0x00c5,0x00c6,0x00c7,0x00c9,0x00d1,0x00d6,0x00dc,0x00df,0x00e0,0x00e1,0x00e2,
-		0x00e4,0x00e5,0x00e6,0x00e7,0x00e8,0x00e9,0x00ea,0x00eb,0x00ec,0x00ed,0x00ee,0x00ef,0x00f1,0x00f2,0x00f3,0x00f4,
-		0x00f6,0x00f7,0x00f9,0x00fa,0x00fb,0x00fc,0x00ff,0x0192,0x0393,0x0398,0x03a3,0x03a6,0x03a9,0x03b1,0x03b4,0x03b5,
-		0x03c0,0x03c3,0x03c4,0x03c6,0x2022,0x203c,0x207f,0x20a7,0x2190,0x2191,0x2192,0x2193,0x2194,0x2195,0x21a8,0x2219,
-		0x221a,0x221e,0x221f,0x2229,0x2248,0x2261,0x2264,0x2265,0x2310,0x2320,0x2321,0x2500,0x2502,0x250c,0x2510,0x2514,
-		0x2518,0x251c,0x2524,0x252c,0x2534,0x253c,0x2550,0x2551,0x2552,0x2553,0x2554,0x2555,0x2556,0x2557,0x2558,0x2559,
-		0x255a,0x255b,0x255c,0x255d,0x255e,0x255f,0x2560,0x2561,0x2562,0x2563,0x2564,0x2565,0x2566,0x2567,0x2568,0x2569,
-		0x256a,0x256b,0x256c,0x2580,0x2584,0x2588,0x258c,0x2590,0x2591,0x2592,0x2593,0x25a0,0x25ac,0x25b2,0x25ba,0x25bc,
-		0x25c4,0x25cb,0x25d8,0x25d9,0x263a,0x263b,0x263c,0x2640,0x2642,0x2660,0x2663,0x2665,0x2666,0x266a,0x266b,
-	};
-	static const uint8_t cp437_index[] = {
-		255,173,155,156,157, 21,166,174,170,248,241,253,230, 20,250,167,
-		175,172,171,168,142,143,146,128,144,165,153,154,225,133,160,131,
-		132,134,145,135,138,130,136,137,141,161,140,139,164,149,162,147,
-		148,246,151,163,150,129,152,159,226,233,228,232,234,224,235,238,
-		227,229,231,237,  7, 19,252,158, 27, 24, 26, 25, 29, 18, 23,249,
-		251,236,239,247,240,243,242,169, 28,244,245,196,179,218,191,192,
-		217,195,180,194,193,197,205,186,213,214,201,184,183,187,212,211,
-		200,190,189,188,198,199,204,181,182,185,209,210,203,207,208,202,
-		216,215,206,223,220,219,221,222,176,177,178,254, 22, 30, 16, 31,
-		 17,  9,  8, 10,  1,  2, 15, 12, 11,  6,  5,  3,  4, 13, 14
-	};
-	int begin = 0;
-	int end = sizeof(cp437_unicode) / sizeof(cp437_unicode[0]);
-	while (begin < end) {
-		int mid = (begin + end) / 2;
-		uint16_t code = cp437_unicode[mid];
-		if (code == unicode) {
-			return cp437_index[mid];
-		}
-		else if (code < unicode)
-			begin = mid + 1;
-		else
-			end = mid;
-	}
-	return -1;
-}
-
-static int
-search_cp936(int unicode) {
-	int begin = 0;
-	int end = sizeof(unimap_cp936) / sizeof(unimap_cp936[0]);
-	while (begin < end) {
-		int mid = (begin + end) / 2;
-		uint16_t code = unimap_cp936[mid];
-		if (code == unicode)
-			return mid;
-		else if (code < unicode)
-			begin = mid + 1;
-		else
-			end = mid;
-	}
-	return -1;
-}
-
-static int
 unicode_index(struct context *ctx, int unicode) {
-	if (unicode <= 127)
-		return unicode;
-	int slot = inthash(unicode);
-	if (ctx->u.unicode[slot] != unicode) {
-		ctx->u.unicode[slot] = unicode;
-		ctx->u.index[slot] = 255;
-		int code = search_cp437(unicode);
-		if (code >= 0) {
-			ctx->u.index[slot] = code;
-		} else {
-			code = search_cp936(unicode);
-			if (code >= 0) {
-				ctx->u.index[slot] = code + 256;
-			}
-		}
-	}
-	return ctx->u.index[slot];
+	if ((unsigned)unicode > 0xffff)
+		return 255;
+	const struct font *f = ctx->raster.font;
+	return f->block[f->page[unicode >> 8]][unicode & 0xff];
 }
 
 static struct context *
@@ -168,6 +362,16 @@ get_int(lua_State *L, int idx, const char * name) {
 	return r;
 }
 
+static int
+get_int_opt(lua_State *L, int idx, const char * name, int def) {
+	if (lua_getfield(L, idx, name) == LUA_TNIL) {
+		lua_pop(L, 1);
+		return def;
+	}
+	lua_pop(L, 1);
+	return get_int(L, idx, name);
+}
+
 static uint32_t
 is_enable(lua_State *L, int idx, const char * name) {
 	lua_getfield(L, idx, name);
@@ -176,831 +380,3939 @@ is_enable(lua_State *L, int idx, const char * name) {
 	return enable ? 0xffffffff : 0;
 }
 
-static void
-init_surface(lua_State *L, struct context *ctx) {
-	ctx->surface = SDL_CreateRGBSurface(0, ctx->width * PIXELWIDTH, ctx->height * PIXELHEIGHT, 24, 0, 0, 0, 0);
-	if (ctx->surface == NULL) {
-		luaL_error(L, "Create surface failed : %s", SDL_GetError());
-	}
-}
-
-static void
-init_slotbuffer(lua_State *L, struct context *ctx) {
-	size_t sz =  ctx->width * ctx->height * sizeof(struct slot);
-	struct slot * s = (struct slot *)lua_newuserdatauv(L, sz, 0);
-	memset(s, 0, sz);
-	ctx->s = s;
-	lua_setiuservalue(L, lua_upvalueindex(1), 1);
-	s->color = 0xffff;
+static inline void
+color16to24(uint16_t c16, uint8_t c[3]) {
+	c[2] = c16 >> 11;
+	c[2] = (c[2] << 3) | (c[2] & 7);
+	c[1] = c16 >> 5;
+	c[1] = (c[1] << 2) | (c[1] & 3);
+	c[0] = (c16 << 3) | (c16 & 3);
 }
 
-static int
-linit(lua_State *L) {
-	struct context * ctx = getCtx(L);
-	if (ctx->window != NULL)
-		return luaL_error(L, "Already init");
-	if (SDL_Init(SDL_INIT_VIDEO) < 0)
-		return luaL_error(L, "Couldn't initialize SDL: %s\n", SDL_GetError());
+static const uint8_t blank_glyph[MAXCELLH];
 
-	luaL_checktype(L, 1, LUA_TTABLE);
+static const struct font builtin_font = {
+	uni6x12_cp437,
+	uni12x12_cp936,
+	256,
+	sizeof(uni12x12_cp936) / 24,
+	12,
+	24,
+	1,
+	2,
+	8,
+	unimap_page,
+	unimap_block,
+};
 
-	int width = get_int(L, 1, "width");
-	int height = get_int(L, 1, "height");
+// The rows of the glyph, the row of the right part of a wide glyph is shifted left by shift bits
+static inline const uint8_t *
+glyph_graph(const struct font *f, const struct slot *s, int *g_pitch, int *shift) {
+	*g_pitch = 1;
+	*shift = 0;
+	if (s->code <= 255) {
+		if (s->code >= f->narrow_n)
+			return blank_glyph;
+		*g_pitch = f->narrow_pitch;
+		return &f->narrow[s->code * f->narrow_size];
+	}
+	int code = s->code - 256;
+	if (code >= f->wide_n)
+		return blank_glyph;
+	*g_pitch = f->wide_pitch;
+	if (s->rightpart)
+		*shift = f->wide_shift;
+	return &f->wide[code * f->wide_size];
+}
 
-	SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+// A row of the glyph, the first pixel is the highest bit
+static inline uint32_t
+glyph_row(const uint8_t *g, int pitch) {
+	uint32_t row = (uint32_t)g[0] << 24;
+	if (pitch > 1)
+		row |= g[1] << 16;
+	if (pitch > 2)
+		row |= g[2] << 8;
+	return row;
+}
 
-	uint32_t flags = 0;
+static FORCEINLINE void
+pixel_color(uint16_t c16, uint8_t pixel[4], const int bpp) {
+	uint8_t c[3];
+	uint32_t c32;
+	switch (bpp) {
+	case 1:
+		pixel[0] = (c16 >> 8 & 0xe0) | (c16 >> 6 & 0x1c) | (c16 >> 3 & 0x03);
+		break;
+	case 2:
+		memcpy(pixel, &c16, 2);
+		break;
+	case 3:
+		color16to24(c16, pixel);
+		break;
+	default:
+		color16to24(c16, c);
+		c32 = c[2] << 16 | c[1] << 8 | c[0];
+		memcpy(pixel, &c32, 4);
+		break;
+	}
+}
 
-	flags |= is_enable(L, 1, "borderless") & SDL_WINDOW_BORDERLESS;
-	flags |= is_enable(L, 1, "resizeable") & SDL_WINDOW_RESIZABLE;
-	flags |= is_enable(L, 1, "fullscreen") & SDL_WINDOW_FULLSCREEN;
+static FORCEINLINE void
+expand_pixels(const struct raster *r, uint8_t *p, const struct slot *s, const int bpp, const int cw, const int ch) {
+	int g_pitch, shift;
+	const uint8_t *g = glyph_graph(r->font, s, &g_pitch, &shift);
+	uint8_t b[4], c[4];
+	pixel_color(s->background, b, bpp);
+	pixel_color(s->color, c, bpp);
+	int i,j;
+	for (i=0;i<ch;i++) {
+		uint32_t m = glyph_row(g, g_pitch) << shift;
+		for (j=0;j<cw;j++) {
+			memcpy(p + j * bpp, (m & 0x80000000) ? c : b, bpp);
+			m <<= 1;
+		}
+		p+=cw * bpp;
+		g+=g_pitch;
+	}
+}
 
-	double scale = 1;
-	if (lua_getfield(L, 1, "scale") != LUA_TNIL) {
-		scale = luaL_checknumber(L, -1);
+// Pack the glyph rows into a bit stream, the highest bit is the first pixel
+static FORCEINLINE void
+glyph_bits(const struct raster *r, const struct slot *s, uint8_t bits[GLYPHBITS], const int cw, const int ch) {
+	int g_pitch, shift;
+	const uint8_t *g = glyph_graph(r->font, s, &g_pitch, &shift);
+	uint64_t acc = 0;
+	int n = 0;
+	int i;
+	for (i=0;i<ch;i++) {
+		acc = acc << cw | (glyph_row(g, g_pitch) << shift) >> (32 - cw);
+		n += cw;
+		while (n >= 8) {
+			n -= 8;
+			*bits++ = acc >> n;
+		}
+		g += g_pitch;
 	}
-	lua_pop(L, 1);
+	*bits++ = n ? acc << (8 - n) : 0;
+	*bits = 0;
+}
 
-	ctx->w = width * scale * PIXELWIDTH;
-	ctx->h = height * scale * PIXELHEIGHT;
+static inline uint64_t
+glyph_window(const uint8_t *bits, int q) {
+	const uint8_t *b = bits + (q >> 3);
+	int shift = q & 7;
+	uint8_t w = b[0] << shift | b[1] >> (8 - shift);
+	return w * 0x0101010101010101ull;
+}
 
-	const char * title = "";
-	if (lua_getfield(L, 1, "title") == LUA_TSTRING) {
-		title = lua_tostring(L, -1);
-		lua_pop(L, 1);
+// 3 patterns of 8 bytes, for the pixels start at byte 0, 8 and 16 of 24 bytes.
+static inline void
+glyph_pattern(const struct raster *r, uint16_t c16, uint64_t pat[3]) {
+	uint8_t c[24];
+	uint8_t pixel[4];
+	switch (r->bpp) {
+	case 1: pixel_color(c16, pixel, 1); break;
+	case 2: pixel_color(c16, pixel, 2); break;
+	case 3: pixel_color(c16, pixel, 3); break;
+	default: pixel_color(c16, pixel, 4); break;
 	}
-
-	SDL_Window *wnd = SDL_CreateWindow(title, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, ctx->w, ctx->h, flags);
-	if (wnd == NULL) {
-        return luaL_error(L, "Couldn't create window : %s", SDL_GetError());
+	int i;
+	for (i=0;i<24;i++) {
+		c[i] = pixel[i % r->bpp];
 	}
+	memcpy(pat, c, 24);
+}
+
+#ifdef RASTER_X86
 
-	flags = is_enable(L, 1, "software") ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
-	flags |= is_enable(L, 1, "vsync") & SDL_RENDERER_PRESENTVSYNC;
+TARGET_SSE2 static FORCEINLINE void
+expand_sse2(const struct raster *r, uint8_t *p, const struct slot *s, const int cw, const int ch) {
+	uint8_t bits[GLYPHBITS];
+	uint64_t fg[3], bg[3];
+	glyph_bits(r, s, bits, cw, ch);
+	glyph_pattern(r, s->color, fg);
+	glyph_pattern(r, s->background, bg);
+	int i;
+	for (i=0;i<r->chunks;i+=2) {
+		__m128i w = _mm_set_epi64x(glyph_window(bits, r->q[i+1]), glyph_window(bits, r->q[i]));
+		__m128i sel = _mm_loadu_si128((const __m128i *)&r->sel[i]);
+		__m128i m = _mm_cmpeq_epi8(_mm_and_si128(w, sel), sel);
+		__m128i f = _mm_set_epi64x(fg[r->phase[i+1]], fg[r->phase[i]]);
+		__m128i b = _mm_set_epi64x(bg[r->phase[i+1]], bg[r->phase[i]]);
+		_mm_storeu_si128((__m128i *)(p + i * 8), _mm_or_si128(_mm_and_si128(m, f), _mm_andnot_si128(m, b)));
+	}
+}
 
-	SDL_Renderer *r = SDL_CreateRenderer(wnd, -1, flags);
-	if (r == NULL) {
-        return luaL_error(L, "Couldn't create renderer: %s", SDL_GetError());
+TARGET_AVX2 static FORCEINLINE void
+expand_avx2(const struct raster *r, uint8_t *p, const struct slot *s, const int cw, const int ch) {
+	uint8_t bits[GLYPHBITS];
+	uint64_t fg[3], bg[3];
+	glyph_bits(r, s, bits, cw, ch);
+	glyph_pattern(r, s->color, fg);
+	glyph_pattern(r, s->background, bg);
+	const uint16_t *q = r->q;
+	const uint8_t *ph = r->phase;
+	int i;
+	for (i=0;i<r->chunks;i+=4) {
+		__m256i w = _mm256_set_epi64x(glyph_window(bits, q[i+3]), glyph_window(bits, q[i+2]),
+			glyph_window(bits, q[i+1]), glyph_window(bits, q[i]));
+		__m256i sel = _mm256_loadu_si256((const __m256i *)&r->sel[i]);
+		__m256i m = _mm256_cmpeq_epi8(_mm256_and_si256(w, sel), sel);
+		__m256i f = _mm256_set_epi64x(fg[ph[i+3]], fg[ph[i+2]], fg[ph[i+1]], fg[ph[i]]);
+		__m256i b = _mm256_set_epi64x(bg[ph[i+3]], bg[ph[i+2]], bg[ph[i+1]], bg[ph[i]]);
+		_mm256_storeu_si256((__m256i *)(p + i * 8), _mm256_blendv_epi8(b, f, m));
 	}
+}
 
-	SDL_RenderSetLogicalSize(r, width * PIXELWIDTH, height * PIXELHEIGHT);
+#endif
 
-	ctx->renderer = r;
-	ctx->window = wnd;
-	ctx->tick = SDL_GetTicks64();
-	ctx->frame = 0;
-	ctx->fps = get_int(L, 1, "fps");
-	ctx->width = width;
-	ctx->height = height;
-	ctx->surface = NULL;
+#ifdef RASTER_NEON
+
+static FORCEINLINE void
+expand_neon(const struct raster *r, uint8_t *p, const struct slot *s, const int cw, const int ch) {
+	uint8_t bits[GLYPHBITS];
+	uint64_t fg[3], bg[3];
+	glyph_bits(r, s, bits, cw, ch);
+	glyph_pattern(r, s->color, fg);
+	glyph_pattern(r, s->background, bg);
+	int i;
+	for (i=0;i<r->chunks;i+=2) {
+		uint8x16_t w = vcombine_u8(vcreate_u8(glyph_window(bits, r->q[i])), vcreate_u8(glyph_window(bits, r->q[i+1])));
+		uint8x16_t sel = vld1q_u8((const uint8_t *)&r->sel[i]);
+		uint8x16_t m = vtstq_u8(w, sel);
+		uint8x16_t f = vcombine_u8(vcreate_u8(fg[r->phase[i]]), vcreate_u8(fg[r->phase[i+1]]));
+		uint8x16_t b = vcombine_u8(vcreate_u8(bg[r->phase[i]]), vcreate_u8(bg[r->phase[i+1]]));
+		vst1q_u8(p + i * 8, vbslq_u8(m, f, b));
+	}
+}
 
-	init_surface(L, ctx);
-	init_slotbuffer(L, ctx);
+#endif
 
-	return 0;
+static inline uint64_t
+glyph_key(const struct slot *s) {
+	return (uint64_t)s->code << 33 | (uint64_t)s->rightpart << 32 | (uint32_t)s->color << 16 | s->background;
 }
 
 static inline void
-color16to24(uint16_t c16, uint8_t c[3]) {
-	c[2] = c16 >> 11;
-	c[2] = (c[2] << 3) | (c[2] & 7);
-	c[1] = c16 >> 5;
-	c[1] = (c[1] << 2) | (c[1] & 3);
-	c[0] = (c16 << 3) | (c16 & 3);
+lru_unlink(struct glyph_cache *c, struct glyph *g) {
+	if (g->next == g) {
+		c->lru = NULL;
+	} else {
+		g->prev->next = g->next;
+		g->next->prev = g->prev;
+		if (c->lru == g)
+			c->lru = g->next;
+	}
 }
 
 static inline void
-draw_slot(uint8_t *p, struct slot *s, int pitch) {
-	const uint8_t *g;
-	int g_pitch;
-	if (s->code <= 255) {
-		g = &uni6x12_cp437[s->code * 12];
-		g_pitch = 1;
+lru_push(struct glyph_cache *c, struct glyph *g) {
+	struct glyph *head = c->lru;
+	if (head == NULL) {
+		g->prev = g->next = g;
 	} else {
-		int code = s->code - 256;
-		g = &uni12x12_cp936[code * 24];
-		if (s->rightpart)
-			++g;
-		g_pitch = 2;
-	}
-	uint8_t b[3], c[3];
-	color16to24(s->background, b);
-	color16to24(s->color, c);
-	int i,j;
-	for (i=0;i<12;i++) {
-		uint8_t m = *g;
-		for (j=0;j<6;j++) {
-			uint8_t *color = (m & 0x80) ? c : b;
-			p[j*3+0] = color[0];
-			p[j*3+1] = color[1];
-			p[j*3+2] = color[2];
-			m <<= 1;
-		}
-		p+=pitch;
-		g+=g_pitch;
+		g->next = head;
+		g->prev = head->prev;
+		head->prev = g;
+		g->prev->next = g;
 	}
+	c->lru = g;
 }
 
-static void
-flush_slotbuffer(uint8_t *p, struct slot *s, int w, int h ) {
-	int i,j;
-	int pitch = w * PIXELWIDTH * 3;
-	for (i=0;i<h;i++) {
-		for (j=0;j<w;j++) {
-			draw_slot(p + j * PIXELWIDTH * 3, &s[j], pitch);
+static inline struct glyph **
+glyph_bucket(struct glyph_cache *c, uint64_t key) {
+	return &c->hash[(key * 0x9E3779B97F4A7C15ull) >> (64 - c->hash_bits)];
+}
+
+static struct glyph *
+fetch_glyph(struct glyph_cache *c, const struct raster *r, const struct slot *s) {
+	uint64_t key = glyph_key(s);
+	struct glyph **slot = glyph_bucket(c, key);
+	struct glyph *g = *slot;
+	while (g) {
+		if (g->key == key) {
+			++c->hit;
+			if (c->lru != g) {
+				lru_unlink(c, g);
+				lru_push(c, g);
+			}
+			return g;
 		}
-		p += pitch * PIXELHEIGHT;
-		s += w;
+		g = g->hash_next;
 	}
+	++c->miss;
+	if (c->n < c->size) {
+		g = (struct glyph *)((char *)c->g + c->stride * c->n++);
+	} else {
+		// evict the least recently used one
+		g = c->lru->prev;
+		lru_unlink(c, g);
+		struct glyph **prev = glyph_bucket(c, g->key);
+		while (*prev != g)
+			prev = &(*prev)->hash_next;
+		*prev = g->hash_next;
+	}
+	g->key = key;
+	g->hash_next = *slot;
+	*slot = g;
+	lru_push(c, g);
+	r->expand(r, g->pixel, s);
+	return g;
 }
 
-static inline void
-draw_sprite(struct context *ctx, struct sprite *spr) {
-	int src_x = 0;
-	int src_y = 0;
-	int des_x = spr->x - ctx->x - spr->kx;
-	int des_y = spr->y - ctx->y - spr->ky;
-	int w = spr->w;
-	int h = spr->h;
-	if (des_x < 0) {
-		src_x -= des_x;
-		if (src_x >= w)
-			return;
-		des_x = 0;
-		w -= src_x;
-	} else if (des_x >= ctx->width) {
-		return;
-	}
-	if (des_x + w > ctx->width) {
-		w =  ctx->width - des_x;
+static FORCEINLINE void
+draw_slot(struct glyph_cache *c, const struct raster *r, uint8_t *p, const struct slot *s, int pitch, const int bpp, const int cw, const int ch) {
+	uint8_t block[GLYPHBLOCK];
+	const uint8_t *src;
+	if (c == NULL) {
+		r->expand(r, block, s);
+		src = block;
+	} else {
+		src = fetch_glyph(c, r, s)->pixel;
 	}
-	if (des_y < 0) {
-		src_y -= des_y;
-		if (src_y >= h)
-			return;
-		des_y = 0;
-		h -= src_y;
-	} else if (des_y >= ctx->height) {
+	int i,j,k;
+	int zoom = r->zoom;
+	if (zoom == 1) {
+		for (i=0;i<ch;i++) {
+			memcpy(p, src, cw * bpp);
+			p += pitch;
+			src += cw * bpp;
+		}
 		return;
 	}
-	if (des_y + h > ctx->height) {
-		h = ctx->height - des_y;
+	// Nearest neighbor, zoom the row into a line buffer and copy it zoom times, the target may be write only.
+	uint8_t line[MAXCELLW * MAXZOOM * 4];
+	for (i=0;i<ch;i++) {
+		uint8_t *l = line;
+		for (j=0;j<cw;j++) {
+			for (k=0;k<zoom;k++) {
+				memcpy(l, src, bpp);
+				l += bpp;
+			}
+			src += bpp;
+		}
+		for (k=0;k<zoom;k++) {
+			memcpy(p, line, l - line);
+			p += pitch;
+		}
 	}
+}
+
+static inline struct slotbuffer
+slotbuffer_offset(struct slotbuffer b, int offset) {
+	b.code += offset;
+	b.color += offset;
+	b.background += offset;
+	return b;
+}
+
+static inline int
+slot_changed(const struct slotbuffer *a, const struct slotbuffer *b, int i) {
+	return a->code[i] != b->code[i]
+		|| a->color[i] != b->color[i]
+		|| a->background[i] != b->background[i];
+}
+
+static inline int
+row_changed(const struct slotbuffer *a, const struct slotbuffer *b, int w) {
+	return memcmp(a->code, b->code, w * sizeof(uint32_t))
+		|| memcmp(a->color, b->color, w * sizeof(uint16_t))
+		|| memcmp(a->background, b->background, w * sizeof(uint16_t));
+}
+
+// Draw the slots changed since the last frame, and mark the changed rows
+static FORCEINLINE void
+flush_slotbuffer(struct glyph_cache *c, const struct raster *r, uint8_t *p, int pitch, struct slotbuffer s, struct slotbuffer last, int w, int h, int dirty, uint8_t *changed, const int bpp, const int cw, const int ch) {
 	int i,j;
-	struct slot *src_slot = &spr->s[src_y * spr->w + src_x];
-	struct slot *des_slot = &ctx->s[des_y * ctx->width + des_x];
+	struct slot tmp;
+	memset(&tmp, 0, sizeof(tmp));
 	for (i=0;i<h;i++) {
-		for (j=0;j<w;j++) {
-			if (ctx->layer[src_slot[j].layer] == 0 && src_slot[j].code) {
-				if (src_slot[j].layer >= des_slot[j].layer) {
-					if (spr->background) {
-						des_slot[j] = src_slot[j];
-					} else {
-						uint16_t bg = des_slot[j].background;
-						des_slot[j] = src_slot[j];
-						des_slot[j].background = bg;
-					}
-				} else if (spr->background) {
-					des_slot[j].background = src_slot[j].background;
+		changed[i] = 0;
+		if (dirty || row_changed(&s, &last, w)) {
+			for (j=0;j<w;j++) {
+				if (dirty || slot_changed(&s, &last, j)) {
+					tmp.code = s.code[j];
+					tmp.rightpart = s.code[j] >> 23;
+					tmp.color = s.color[j];
+					tmp.background = s.background[j];
+					draw_slot(c, r, p + j * cw * r->zoom * bpp, &tmp, pitch, bpp, cw, ch);
+					changed[i] = 1;
 				}
 			}
 		}
-		src_slot += spr->w;
-		des_slot += ctx->width;
+		p += pitch * ch * r->zoom;
+		s = slotbuffer_offset(s, w);
+		last = slotbuffer_offset(last, w);
 	}
 }
 
-static void
-draw_sprites(struct context *ctx) {
-	struct sprite * spr = ctx->spr;
-	if (spr == NULL)
-		return;
-	do {
-		draw_sprite(ctx, spr);
-		spr = spr->next;
-	} while (spr != ctx->spr);
-}
+// The kernels specialized for each cell size and bpp, so the loops of a glyph are unrolled by the compiler
+#define SCALAR_KERNELS(W, H) \
+static void expand_scalar8_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_pixels(r, p, s, 1, W, H); } \
+static void expand_scalar16_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_pixels(r, p, s, 2, W, H); } \
+static void expand_scalar24_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_pixels(r, p, s, 3, W, H); } \
+static void expand_scalar32_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_pixels(r, p, s, 4, W, H); } \
+static void flush_slotbuffer8_##W##x##H(struct glyph_cache *c, const struct raster *r, uint8_t *p, int pitch, struct slotbuffer s, struct slotbuffer last, int w, int h, int dirty, uint8_t *changed) { \
+	flush_slotbuffer(c, r, p, pitch, s, last, w, h, dirty, changed, 1, W, H); } \
+static void flush_slotbuffer16_##W##x##H(struct glyph_cache *c, const struct raster *r, uint8_t *p, int pitch, struct slotbuffer s, struct slotbuffer last, int w, int h, int dirty, uint8_t *changed) { \
+	flush_slotbuffer(c, r, p, pitch, s, last, w, h, dirty, changed, 2, W, H); } \
+static void flush_slotbuffer24_##W##x##H(struct glyph_cache *c, const struct raster *r, uint8_t *p, int pitch, struct slotbuffer s, struct slotbuffer last, int w, int h, int dirty, uint8_t *changed) { \
+	flush_slotbuffer(c, r, p, pitch, s, last, w, h, dirty, changed, 3, W, H); } \
+static void flush_slotbuffer32_##W##x##H(struct glyph_cache *c, const struct raster *r, uint8_t *p, int pitch, struct slotbuffer s, struct slotbuffer last, int w, int h, int dirty, uint8_t *changed) { \
+	flush_slotbuffer(c, r, p, pitch, s, last, w, h, dirty, changed, 4, W, H); }
 
-static void
-flip_surface(struct context *ctx) {
-	SDL_Surface *ws = SDL_GetWindowSurface(ctx->window);
-	int w = ctx->width * PIXELWIDTH;
-	int h = ctx->height * PIXELHEIGHT;
+#define SCALAR_TABLE(W, H) { W, H, \
+	{ expand_scalar8_##W##x##H, expand_scalar16_##W##x##H, expand_scalar24_##W##x##H, expand_scalar32_##W##x##H }, \
+	{ flush_slotbuffer8_##W##x##H, flush_slotbuffer16_##W##x##H, flush_slotbuffer24_##W##x##H, flush_slotbuffer32_##W##x##H } }
 
-	draw_sprites(ctx);
+SCALAR_KERNELS(6, 12)
+SCALAR_KERNELS(8, 8)
+SCALAR_KERNELS(8, 16)
+SCALAR_KERNELS(12, 24)
 
-	SDL_LockSurface(ctx->surface);
-	flush_slotbuffer(ctx->surface->pixels, ctx->s, ctx->width, ctx->height);
-	SDL_UnlockSurface(ctx->surface);
-	memset(ctx->s, 0, sizeof(struct slot) * ctx->width * ctx->height);
+#ifdef RASTER_X86
 
-	if (ws->w == w && ws->h == h) {
-		SDL_BlitSurface(ctx->surface, NULL, ws, NULL);
-	} else {
-		SDL_BlitScaled(ctx->surface, NULL, ws, NULL);
+#define X86_KERNELS(W, H) \
+TARGET_SSE2 static void expand_sse2_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_sse2(r, p, s, W, H); } \
+TARGET_AVX2 static void expand_avx2_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_avx2(r, p, s, W, H); }
+
+X86_KERNELS(6, 12)
+X86_KERNELS(8, 8)
+X86_KERNELS(8, 16)
+X86_KERNELS(12, 24)
+
+static const expand_func expand_sse2_cell[] = { expand_sse2_6x12, expand_sse2_8x8, expand_sse2_8x16, expand_sse2_12x24 };
+static const expand_func expand_avx2_cell[] = { expand_avx2_6x12, expand_avx2_8x8, expand_avx2_8x16, expand_avx2_12x24 };
+
+#endif
+
+#ifdef RASTER_NEON
+
+#define NEON_KERNELS(W, H) \
+static void expand_neon_##W##x##H(const struct raster *r, uint8_t *p, const struct slot *s) { expand_neon(r, p, s, W, H); }
+
+NEON_KERNELS(6, 12)
+NEON_KERNELS(8, 8)
+NEON_KERNELS(8, 16)
+NEON_KERNELS(12, 24)
+
+static const expand_func expand_neon_cell[] = { expand_neon_6x12, expand_neon_8x8, expand_neon_8x16, expand_neon_12x24 };
+
+#endif
+
+// The cell sizes in the same order of the vector kernels and the cell option of c.init
+static const struct {
+	int w;
+	int h;
+	expand_func scalar[4];
+	flush_func flush[4];
+} cell_kernels[] = {
+	SCALAR_TABLE(6, 12),
+	SCALAR_TABLE(8, 8),
+	SCALAR_TABLE(8, 16),
+	SCALAR_TABLE(12, 24),
+};
+
+static int
+init_raster(struct raster *r, int bpp, const char *kernel, int cell) {
+	struct {
+		const char *name;
+		expand_func expand;
+		int support;
+	} k[] = {
+#ifdef RASTER_X86
+		{ "avx2", expand_avx2_cell[cell], SDL_HasAVX2() },
+		{ "sse2", expand_sse2_cell[cell], SDL_HasSSE2() },
+#endif
+#ifdef RASTER_NEON
+		{ "neon", expand_neon_cell[cell], SDL_HasNEON() },
+#endif
+		{ "scalar", NULL, 1 },
+	};
+	int i,j;
+	r->name = NULL;
+	r->font = &builtin_font;
+	for (i=0;i<sizeof(k)/sizeof(k[0]);i++) {
+		if (k[i].support && (kernel == NULL || strcmp(kernel, k[i].name) == 0)) {
+			r->name = k[i].name;
+			r->expand = k[i].expand ? k[i].expand : cell_kernels[cell].scalar[bpp-1];
+			r->vector = k[i].expand != NULL;
+			break;
+		}
 	}
-	SDL_UpdateWindowSurface(ctx->window);
+	if (r->name == NULL)
+		return 0;
+	r->flush = cell_kernels[cell].flush[bpp-1];
+	r->bpp = bpp;
+	r->zoom = 1;
+	r->cell_w = cell_kernels[cell].w;
+	r->cell_h = cell_kernels[cell].h;
+	int bytes = r->cell_w * r->cell_h * bpp;
+	r->block = (bytes + 31) & ~31;
+	r->chunks = r->block / 8;
+	for (i=0;i<r->chunks;i++) {
+		uint8_t sel[8];
+		int offset = i * 8;
+		int q = offset / bpp;
+		for (j=0;j<8;j++) {
+			sel[j] = offset + j < bytes ? 0x80 >> ((offset + j) / bpp - q) : 0;
+		}
+		r->q[i] = offset < bytes ? q : 0;
+		r->phase[i] = (offset % 24) / 8;
+		memcpy(&r->sel[i], sel, 8);
+	}
+	return 1;
 }
 
-static int
-lframe(lua_State *L) {
-	struct context * ctx = getCtx(L);
-	if (ctx->surface == NULL)
-		return luaL_error(L, "Init first");
-	ctx->x = luaL_optinteger(L, 1, 0);
-	ctx->y = luaL_optinteger(L, 2, 0);
-	flip_surface(ctx);
-	uint64_t c = SDL_GetTicks64();
-	int lastframe = ctx->frame;
-	int frame = lastframe + 1;
-	if (frame > ctx->fps) {
-		lastframe = 0;
-		frame = 1;
-	}
-	int delta = FRAMESEC * frame / ctx->fps - FRAMESEC * lastframe / ctx->fps;
-	ctx->frame = frame;
-	ctx->tick += delta;
-	if (c < ctx->tick)
-		SDL_Delay(ctx->tick - c);
-	if (c - ctx->tick > FRAMESEC) {
-		// reset frame count if the error is too large
-		ctx->tick = c;
-		ctx->frame = 0;
+static SDL_Surface *
+get_surface(lua_State *L, struct context *ctx) {
+	if (ctx->surface)
+		return ctx->surface;
+	int zoom = ctx->raster.zoom;
+	ctx->surface = SDL_CreateRGBSurfaceWithFormat(0, ctx->width * ctx->raster.cell_w * zoom, ctx->height * ctx->raster.cell_h * zoom, 0, ctx->format);
+	if (ctx->surface == NULL) {
+		luaL_error(L, "Create surface failed : %s", SDL_GetError());
+	}
+	SDL_Palette *pal = ctx->surface->format->palette;
+	if (pal) {
+		// RGB332
+		SDL_Color c[256];
+		int i;
+		for (i=0;i<256;i++) {
+			c[i].r = (i >> 5) * 255 / 7;
+			c[i].g = (i >> 2 & 7) * 255 / 7;
+			c[i].b = (i & 3) * 255 / 3;
+			c[i].a = 255;
+		}
+		SDL_SetPaletteColors(pal, c, 0, 256);
 	}
+	return ctx->surface;
+}
 
-	return 0;
+static uint8_t *
+slotbuffer_init(struct slotbuffer *b, uint8_t *p, int n) {
+	b->code = (uint32_t *)p;
+	p += n * sizeof(uint32_t);
+	b->color = (uint16_t *)p;
+	p += n * sizeof(uint16_t);
+	b->background = (uint16_t *)p;
+	p += n * sizeof(uint16_t);
+	return p;
 }
 
 static void
-resize_window(struct context *ctx, int width, int height) {
-	int ow = ctx->width * PIXELWIDTH;
-	int oh = ctx->height * PIXELHEIGHT;
-	if (ow * height == oh * width) {
-		ctx->w = width;
-		ctx->h = height;
-		return;
-	}
-	if (width > ctx->w) {
-		// enlarge width
-		height = oh * width / ow;
-	} else if (height > ctx->h) {
-		// enlarge height
-		width = ow * height / oh;
-	} else if (width < ctx->w) {
-		// shrink width
-		height = oh * width / ow;
-	} else {
-		// shrink height
-		width = ow * height / oh;
-	}
+init_slotbuffer(lua_State *L, struct context *ctx, int pipeline) {
+	int cells = ctx->width * ctx->height;
+	size_t sz = cells * (sizeof(uint32_t) + sizeof(uint16_t) * 2);
+	int n = pipeline ? 3 : 2;
+	// current slots, last slots, (spare slots,) one rect and one changed flag per row, the coverage of each slot
+	uint8_t * p = (uint8_t *)lua_newuserdatauv(L, sz * n + ctx->height * (sizeof(SDL_Rect) + 1) + cells, 0);
+	memset(p, 0, sz * n);
+	p = slotbuffer_init(&ctx->s, p, cells);
+	p = slotbuffer_init(&ctx->last, p, cells);
+	if (pipeline)
+		p = slotbuffer_init(&ctx->spare, p, cells);
+	else
+		memset(&ctx->spare, 0, sizeof(ctx->spare));
+	ctx->rects = (SDL_Rect *)p;
+	ctx->changed = (uint8_t *)(ctx->rects + ctx->height);
+	ctx->cover = ctx->changed + ctx->height;
+	ctx->dirty = 1;
+	lua_setiuservalue(L, lua_upvalueindex(1), 1);
+	ctx->s.color[0] = 0xffff;
+}
 
-	ctx->w = width;
-	ctx->h = height;
+static inline int
+glyph_stride(int block) {
+	return (offsetof(struct glyph, pixel) + block + 7) & ~7;
+}
 
-	SDL_SetWindowSize(ctx->window, width, height);
+// The hash slots and the glyphs follow the header, the size of a glyph depends on the cell size and bpp
+static size_t
+glyphcache_size(int size, int block) {
+	if (size <= 0)
+		return 0;
+	int bits = 1;
+	while ((1 << bits) < size)
+		++bits;
+	return sizeof(struct glyph_cache) + sizeof(struct glyph *) * (1 << bits) + glyph_stride(block) * size;
+}
+
+static struct glyph_cache *
+glyphcache_init(void *buffer, int size, int block) {
+	if (size <= 0)
+		return NULL;
+	int bits = 1;
+	while ((1 << bits) < size)
+		++bits;
+	struct glyph_cache *c = (struct glyph_cache *)buffer;
+	c->size = size;
+	c->n = 0;
+	c->stride = glyph_stride(block);
+	c->hash_bits = bits;
+	c->hit = 0;
+	c->miss = 0;
+	c->lru = NULL;
+	c->hash = (struct glyph **)(c + 1);
+	memset(c->hash, 0, sizeof(struct glyph *) * (1 << bits));
+	c->g = (struct glyph *)(c->hash + (1 << bits));
+	return c;
 }
 
 static void
-winevent(lua_State *L, SDL_Event *ev) {
-	struct context * ctx = getCtx(L);
-	switch (ev->window.event) {
-		case SDL_WINDOWEVENT_SIZE_CHANGED :
-			resize_window(ctx, ev->window.data1, ev->window.data2);
-			break;
-	}
+init_glyphcache(lua_State *L, struct context *ctx, int size) {
+	ctx->cache = NULL;
+	if (size <= 0)
+		return;
+	void *buffer = lua_newuserdatauv(L, glyphcache_size(size, ctx->raster.block), 0);
+	ctx->cache = glyphcache_init(buffer, size, ctx->raster.block);
+	lua_setiuservalue(L, lua_upvalueindex(1), 2);
 }
 
 static int
-keyevent(lua_State *L, SDL_Event *ev) {
-//	if (ev->key.repeat)
-//		return 0;
-	lua_pushstring(L, "KEY");
-	lua_pushstring(L, SDL_GetKeyName(ev->key.keysym.sym));
-	lua_pushboolean(L, ev->key.type == SDL_KEYDOWN);
-	return 3;
+spritepool_alloc(struct spritepool *p) {
+	int id;
+	if (p->nfree > 0)
+		id = p->free[--p->nfree];
+	else if (p->top < p->cap)
+		id = p->top++;
+	else
+		return -1;
+	p->state[id] = SPRITE_HIDDEN;
+	return id;
 }
 
 static void
-screen_coord(struct context *ctx, int *x, int *y) {
-	*x /= PIXELWIDTH;
-	*y /= PIXELHEIGHT;
+spritepool_free(struct spritepool *p, int id) {
+	p->state[id] = SPRITE_FREE;
+	p->free[p->nfree++] = id;
 }
 
-static int
-motionevent(lua_State *L, SDL_Event *ev) {
-	struct context * ctx = getCtx(L);
-	int x = ev->motion.x;
-	int y = ev->motion.y;
-	screen_coord(ctx, &x, &y);
-	if (x == ctx->mousex && y == ctx->mousey)
-		return 0;
-	ctx->mousex = x;
-	ctx->mousey = y;
-	lua_pushstring(L, "MOTION");
-	lua_pushinteger(L, x);
-	lua_pushinteger(L, y);
-	return 3;
+static size_t
+spritepool_size(int cap) {
+	return (sizeof(struct sprite) + sizeof(int) + 1) * cap;
 }
 
-static int
-buttonevent(lua_State *L, SDL_Event *ev) {
-	struct context * ctx = getCtx(L);
-	int x = ev->motion.x;
-	int y = ev->motion.y;
-	screen_coord(ctx, &x, &y);
-	ctx->mousex = x;
-	ctx->mousey = y;
-	lua_pushstring(L, "BUTTON");
-	lua_pushinteger(L, x);
-	lua_pushinteger(L, y);
-	lua_pushinteger(L, ev->button.button);
-	lua_pushboolean(L, ev->button.state == SDL_PRESSED);
-	lua_pushinteger(L, ev->button.clicks);
-	return 6;
+static void
+spritepool_init(struct spritepool *p, void *buffer, int cap) {
+	p->sprite = (struct sprite *)buffer;
+	p->free = (int *)(p->sprite + cap);
+	p->state = (uint8_t *)(p->free + cap);
+	memset(p->state, SPRITE_FREE, cap);
+	p->cap = cap;
+	p->nfree = 0;
+	p->top = 0;
 }
 
-static int
-levent(lua_State *L) {
-	SDL_Event event;
-
-	int r;
+// The pool and the table of the bodies referenced by the handles are the uservalue 5 and 6 of the context
+static void
+init_spritepool(lua_State *L, struct context *ctx, int cap) {
+	if (cap <= 0)
+		return;
+	void *buffer = lua_newuserdatauv(L, spritepool_size(cap), 0);
+	spritepool_init(&ctx->sprites, buffer, cap);
+	lua_setiuservalue(L, lua_upvalueindex(1), 5);
+	lua_createtable(L, cap, 0);
+	lua_setiuservalue(L, lua_upvalueindex(1), 6);
+}
 
-	while (SDL_PollEvent(&event)) {
-		switch (event.type)	{
-			case SDL_QUIT:
-				lua_pushstring(L, "QUIT");
-				return 1;
-			case SDL_WINDOWEVENT:
-				winevent(L, &event);
-				break;
-			case SDL_KEYDOWN:
-			case SDL_KEYUP:
-				if ((r = keyevent(L, &event)) > 0)
-					return r;
-				break;
-			case SDL_TEXTEDITING:
-				SDL_StopTextInput();
-				break;
-			case SDL_MOUSEMOTION:
-				if ((r = motionevent(L, &event)) > 0)
-					return r;
-				break;
-			case SDL_MOUSEBUTTONDOWN:
-			case SDL_MOUSEBUTTONUP:
-				return buttonevent(L, &event);
-			default:
-				break;
+static void
+run_worker(struct pool *p, struct worker *w) {
+	int i;
+	int id = w - p->w;
+	// Take the tiles of its own range first, then steal from the others
+	for (i=0;i<p->n;i++) {
+		struct worker *q = &p->w[(id + i) % p->n];
+		int tile;
+		while ((tile = SDL_AtomicAdd(&q->next, 1)) < q->end) {
+			run_tile(p->ctx, w->cache, p->job, tile);
 		}
 	}
-	return 0;
 }
 
-static struct sprite *
-getSpr(lua_State *L) {
-	struct sprite *spr = lua_touserdata(L, 1);
-	if (spr == NULL)
-		luaL_error(L, "Need sprite");
-	return spr;
-}
-
-
 static int
-lsetpos(lua_State *L) {
-	struct sprite *spr = getSpr(L);
-	spr->x = luaL_checkinteger(L, 2);
-	spr->y = luaL_checkinteger(L, 3);
+worker_thread(void *ud) {
+	struct worker *w = (struct worker *)ud;
+	struct pool *p = w->pool;
+	for (;;) {
+		SDL_SemWait(w->start);
+		if (p->quit)
+			break;
+		run_worker(p, w);
+		SDL_SemPost(p->done);
+	}
 	return 0;
 }
 
 static void
-link_sprite(struct context *ctx, struct sprite *spr) {
-	struct sprite * node = ctx->spr;
-	if (node == NULL) {
-		spr->prev = spr->next = spr;
-	} else {
-		// insert before node
-		spr->next = node;
-		spr->prev = node->prev;
-
-		node->prev = spr;
-		spr->prev->next = spr;
+pool_run(struct pool *p, int job, int ntiles) {
+	int i;
+	p->job = job;
+	for (i=0;i<p->n;i++) {
+		struct worker *w = &p->w[i];
+		SDL_AtomicSet(&w->next, ntiles * i / p->n);
+		w->end = ntiles * (i + 1) / p->n;
+	}
+	for (i=1;i<p->n;i++) {
+		SDL_SemPost(p->w[i].start);
+	}
+	run_worker(p, &p->w[0]);
+	for (i=1;i<p->n;i++) {
+		SDL_SemWait(p->done);
 	}
-	ctx->spr = spr;
 }
 
 static void
-unlink_sprite(struct context *ctx, struct sprite *spr) {
-	if (ctx->spr == spr) {
-		if (spr->prev == spr->next) {
-			ctx->spr = NULL;
-		} else {
-			ctx->spr = spr->next;
+release_pool(struct pool *p) {
+	int i;
+	p->quit = 1;
+	for (i=1;i<p->n;i++) {
+		struct worker *w = &p->w[i];
+		if (w->thread) {
+			SDL_SemPost(w->start);
+			SDL_WaitThread(w->thread, NULL);
+			w->thread = NULL;
+		}
+		if (w->start) {
+			SDL_DestroySemaphore(w->start);
+			w->start = NULL;
 		}
 	}
-	struct sprite *prev = spr->prev;
-	struct sprite *next = spr->next;
-	prev->next = next;
-	next->prev = prev;
-	spr->prev = NULL;
-	spr->next = NULL;
+	if (p->done) {
+		SDL_DestroySemaphore(p->done);
+		p->done = NULL;
+	}
 }
 
-static int
-lvisible(lua_State *L) {
-	struct sprite *spr = getSpr(L);
-	int visible = lua_toboolean(L, 2);
-	if (visible) {
-		if (spr->prev)
-			return 0;	// already visible
-		struct context *ctx = getCtx(L);
-		link_sprite(ctx, spr);
-	} else {
-		if (spr->prev == NULL)
-			return 0;	// already invisible
-		struct context *ctx = getCtx(L);
-		unlink_sprite(ctx, spr);
+static void
+init_pool(lua_State *L, struct context *ctx, int n, int cache_size) {
+	ctx->pool = NULL;
+	ctx->tile_rows = ctx->height;
+	if (n <= 0)
+		n = SDL_GetCPUCount();
+	if (n > MAXTHREAD)
+		n = MAXTHREAD;
+	if (n <= 1)
+		return;
+	size_t sz = (sizeof(struct pool) + sizeof(struct worker) * (n - 1) + 7) & ~7;
+	size_t csz = glyphcache_size(cache_size, ctx->raster.block);
+	struct pool *p = (struct pool *)lua_newuserdatauv(L, sz + csz * (n - 1), 0);
+	memset(p, 0, sz);
+	lua_setiuservalue(L, lua_upvalueindex(1), 3);
+	p->ctx = ctx;
+	p->n = n;
+	ctx->pool = p;
+	ctx->tile_rows = TILEROWS;
+	p->done = SDL_CreateSemaphore(0);
+	if (p->done == NULL)
+		luaL_error(L, "Create semaphore failed : %s", SDL_GetError());
+	int i;
+	p->w[0].pool = p;
+	p->w[0].cache = ctx->cache;
+	for (i=1;i<n;i++) {
+		struct worker *w = &p->w[i];
+		w->pool = p;
+		w->cache = glyphcache_init((char *)p + sz + csz * (i - 1), cache_size, ctx->raster.block);
+		w->start = SDL_CreateSemaphore(0);
+		if (w->start == NULL)
+			luaL_error(L, "Create semaphore failed : %s", SDL_GetError());
+		w->thread = SDL_CreateThread(worker_thread, "rogue", w);
+		if (w->thread == NULL)
+			luaL_error(L, "Create thread failed : %s", SDL_GetError());
 	}
-	return 0;
 }
 
+static void init_pipeline(lua_State *L, struct context *ctx);
+static void init_font(lua_State *L, struct context *ctx);
+
 static int
-lspriteinfo(lua_State *L) {
-	struct sprite *spr = lua_touserdata(L, 1);
-	lua_pushfstring(L, "[sprite %dx%d+%d+%d %d %d]", spr->w, spr->h, spr->kx, spr->ky, spr->x, spr->y);
+linit(lua_State *L) {
+	struct context * ctx = getCtx(L);
+	if (ctx->window != NULL)
+		return luaL_error(L, "Already init");
+	if (SDL_Init(SDL_INIT_VIDEO) < 0)
+		return luaL_error(L, "Couldn't initialize SDL: %s\n", SDL_GetError());
 
-	return 1;
-}
+	luaL_checktype(L, 1, LUA_TTABLE);
 
-struct sprite_attribs {
-	int transparency;
-	uint16_t background;
-	uint16_t color;
-	uint8_t layer;
-};
+	int width = get_int(L, 1, "width");
+	int height = get_int(L, 1, "height");
 
-/*
-**    From lua 5.4 lutf8lib.c
-** Decode one UTF-8 sequence, returning NULL if byte sequence is
-** invalid.  The array 'limits' stores the minimum value for each
-** sequence length, to check for overlong representations. Its first
-** entry forces an error for non-ascii bytes with no continuation
-** bytes (count == 0).
-*/
-static const char *
-utf8_decode(const char *s, int *val) {
-  static const int limits[] =
-        {~(int)0, 0x80, 0x800, 0x10000u, 0x200000u, 0x4000000u};
-  unsigned int c = (unsigned char)s[0];
-  int res = 0;  /* final result */
-  if (c < 0x80)  /* ascii? */
-    res = c;
-  else {
-    int count = 0;  /* to count number of continuation bytes */
-    for (; c & 0x40; c <<= 1) {  /* while it needs continuation bytes... */
-      unsigned int cc = (unsigned char)s[++count];  /* read next byte */
-      if ((cc & 0xC0) != 0x80)  /* not a continuation byte? */
-        return NULL;  /* invalid byte sequence */
-      res = (res << 6) | (cc & 0x3F);  /* add lower 6 bits from cont. byte */
-    }
-    res |= ((int)(c & 0x7F) << (count * 5));  /* add first byte */
-    if (count > 5 || res < limits[count])
-      return NULL;  /* invalid byte sequence */
-    s += count;  /* skip continuation bytes read */
-  }
-  if (val) *val = res;
-  return s + 1;  /* +1 to include first byte */
-}
+	uint32_t flags = 0;
 
-static void
-sprite_graph(lua_State *L, int idx, struct context *ctx, struct sprite *spr, struct sprite_attribs *attrib) {
-	int i,j;
-	struct slot *s = spr->s;
-	for (i=0;i<spr->h;i++) {
-		lua_geti(L, idx, i+1);
-		const char * str = lua_tostring(L, -1);
+	flags |= is_enable(L, 1, "borderless") & SDL_WINDOW_BORDERLESS;
+	flags |= is_enable(L, 1, "resizeable") & SDL_WINDOW_RESIZABLE;
+	flags |= is_enable(L, 1, "fullscreen") & SDL_WINDOW_FULLSCREEN;
+
+	static const char * format_name[] = { "index8", "rgb565", "rgb24", "xrgb8888", NULL };
+	static const uint32_t format[] = { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_RGB888 };
+	lua_getfield(L, 1, "format");
+	int bpp = luaL_checkoption(L, -1, "rgb24", format_name) + 1;
+	lua_pop(L, 1);
+	static const char * backend_name[] = { "surface", "texture", NULL };
+	lua_getfield(L, 1, "backend");
+	int backend = luaL_checkoption(L, -1, "surface", backend_name);
+	lua_pop(L, 1);
+	if (bpp == 1 && backend == 1)
+		return luaL_error(L, "The texture backend doesn't support index8 format");	// SDL2 can't create a palettized texture
+	static const char * cell_name[] = { "6x12", "8x8", "8x16", "12x24", NULL };
+	lua_getfield(L, 1, "cell");
+	int cell = luaL_checkoption(L, -1, "6x12", cell_name);
+	lua_pop(L, 1);
+	const char * kernel = NULL;
+	if (lua_getfield(L, 1, "kernel") == LUA_TSTRING) {
+		kernel = lua_tostring(L, -1);
+	}
+	if (!init_raster(&ctx->raster, bpp, kernel, cell))
+		return luaL_error(L, "Unsupported kernel %s", kernel);
+	lua_pop(L, 1);
+
+	double scale = 1;
+	if (lua_getfield(L, 1, "scale") != LUA_TNIL) {
+		scale = luaL_checknumber(L, -1);
+	}
+	lua_pop(L, 1);
+
+	ctx->w = width * scale * ctx->raster.cell_w;
+	ctx->h = height * scale * ctx->raster.cell_h;
+
+	const char * title = "";
+	if (lua_getfield(L, 1, "title") == LUA_TSTRING) {
+		title = lua_tostring(L, -1);
 		lua_pop(L, 1);
-		for (j=0;j<spr->w;j++) {
-			s[j].background = attrib->background;
-			s[j].color = attrib->color;
-			s[j].layer = attrib->layer;
-			int unicode;
-			if (!(str = utf8_decode(str, &unicode)))
-				luaL_error(L, "Invalid utf8 text");
-			int c = unicode_index(ctx, unicode);
-			if (c == attrib->transparency)
-				c = 0;
-			s[j].code = c;
-			s[j].rightpart = 0;
-			if (c > 256) {
-				s[j+1] = s[j];
-				s[j+1].rightpart = 1;
-				++j;
-			}
+	}
+
+	SDL_Window *wnd = SDL_CreateWindow(title, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, ctx->w, ctx->h, flags);
+	if (wnd == NULL) {
+        return luaL_error(L, "Couldn't create window : %s", SDL_GetError());
+	}
+
+	ctx->window = wnd;
+	ctx->tick = SDL_GetPerformanceCounter();
+	ctx->last_tick = 0;
+	ctx->frame = 0;
+	ctx->fps = get_int(L, 1, "fps");
+	ctx->spin = get_int_opt(L, 1, "spin", SPINTIME);
+	if (ctx->spin < 0)
+		ctx->spin = 0;
+	int cache_size = GLYPHCACHE;
+	if (lua_getfield(L, 1, "glyphcache") == LUA_TNUMBER) {
+		cache_size = lua_tointeger(L, -1);
+	}
+	lua_pop(L, 1);
+	init_font(L, ctx);
+	ctx->width = width;
+	ctx->height = height;
+	ctx->surface = NULL;
+	ctx->target = NULL;
+	ctx->format = format[bpp-1];
+
+	static const char * compose_name[] = { "painter", "topdown", NULL };
+	lua_getfield(L, 1, "compose");
+	ctx->topdown = luaL_checkoption(L, -1, "painter", compose_name);
+	lua_pop(L, 1);
+
+	int pipeline = is_enable(L, 1, "pipeline");
+	init_slotbuffer(L, ctx, pipeline);
+	init_glyphcache(L, ctx, cache_size);
+	init_pool(L, ctx, get_int_opt(L, 1, "threads", 1), cache_size);
+	init_spritepool(L, ctx, get_int_opt(L, 1, "sprites", 0));
+	if (pipeline)
+		init_pipeline(L, ctx);
+
+	if (backend == 1) {
+		// The window surface can't be used with a renderer, create the renderer for the texture backend only
+		flags = is_enable(L, 1, "software") ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+		flags |= is_enable(L, 1, "vsync") & SDL_RENDERER_PRESENTVSYNC;
+
+		SDL_Renderer *r = SDL_CreateRenderer(wnd, -1, flags);
+		if (r == NULL) {
+			return luaL_error(L, "Couldn't create renderer: %s", SDL_GetError());
 		}
-		s += spr->w;
+
+		SDL_RenderSetLogicalSize(r, width * ctx->raster.cell_w, height * ctx->raster.cell_h);
+
+		SDL_Texture *tex = SDL_CreateTexture(r, ctx->format, SDL_TEXTUREACCESS_STREAMING, width * ctx->raster.cell_w, height * ctx->raster.cell_h);
+		if (tex == NULL) {
+			return luaL_error(L, "Couldn't create texture: %s", SDL_GetError());
+		}
+		ctx->renderer = r;
+		ctx->texture = tex;
 	}
+
+	return 0;
 }
 
-static inline uint16_t
-color24to16(uint32_t c) {
-	int r = (c >> 16) & 0xff;
+// The part of a rect of slots in the rows [top, bottom) of the screen
+struct clip {
+	const struct slot *src;
+	const struct body *sparse;	// the spans of a sparse body, instead of src
+	int src_x;
+	int src_y;
+	int pitch;	// the width of the source slots
+	int des;	// the offset of the screen slots
+	int w;
+	int h;
+	int background;
+	int tint;
+};
+
+// Clip the w * h slots (in pitch) at (x, y) of the world
+static int
+clip_slots(struct context *ctx, const struct slot *s, int pitch, int x, int y, int w, int h, int top, int bottom, struct clip *c) {
+	int src_x = 0;
+	int src_y = 0;
+	int des_x = x - ctx->x;
+	int des_y = y - ctx->y;
+	if (des_x < 0) {
+		src_x -= des_x;
+		if (src_x >= w)
+			return 0;
+		des_x = 0;
+		w -= src_x;
+	} else if (des_x >= ctx->width) {
+		return 0;
+	}
+	if (des_x + w > ctx->width) {
+		w =  ctx->width - des_x;
+	}
+	if (des_y < top) {
+		src_y = top - des_y;
+		if (src_y >= h)
+			return 0;
+		des_y = top;
+		h -= src_y;
+	} else if (des_y >= bottom) {
+		return 0;
+	}
+	if (des_y + h > bottom) {
+		h = bottom - des_y;
+	}
+	c->src = s ? &s[src_y * pitch + src_x] : NULL;
+	c->sparse = NULL;
+	c->tint = -1;
+	c->src_x = src_x;
+	c->src_y = src_y;
+	c->pitch = pitch;
+	c->des = des_y * ctx->width + des_x;
+	c->w = w;
+	c->h = h;
+	return 1;
+}
+
+static inline int
+clip_sprite(struct context *ctx, struct sprite *spr, int top, int bottom, struct clip *c) {
+	struct body *b = spr->body;
+	c->background = spr->background;
+	if (!clip_slots(ctx, b->sparse ? NULL : b->s, spr->w, spr->x - spr->kx, spr->y - spr->ky, spr->w, spr->h, top, bottom, c))
+		return 0;
+	if (b->sparse)
+		c->sparse = b;
+	c->tint = spr->tint;
+	return 1;
+}
+
+// The part of the span sp in the clipped columns, returns the length
+static inline int
+clip_span(const struct clip *c, const struct span *sp, const struct body *b, const struct slot **src, int *des_x) {
+	int x0 = sp->x;
+	int x1 = sp->x + sp->n;
+	int right = c->src_x + c->w;
+	if (x0 < c->src_x)
+		x0 = c->src_x;
+	if (x1 > right)
+		x1 = right;
+	if (x1 <= x0)
+		return 0;
+	*src = &b->s[sp->slot + x0 - sp->x];
+	*des_x = x0 - c->src_x;
+	return x1 - x0;
+}
+
+static int
+blit_spans(struct context *ctx, const struct clip *c, int *overdraw) {
+	const struct body *b = c->sparse;
+	int i,j;
+	int n = 0;
+	int hidden = 0;
+	struct slotbuffer des = slotbuffer_offset(ctx->s, c->des);
+	for (i=0;i<c->h;i++) {
+		int y = c->src_y + i;
+		const struct span *sp = &b->span[b->row[y]];
+		const struct span *end = &b->span[b->row[y+1]];
+		for (;sp < end;sp++) {
+			const struct slot *src = NULL;
+			int x = 0;
+			int w = clip_span(c, sp, b, &src, &x);
+			for (j=0;j<w;j++) {
+				hidden += des.code[x+j] != 0;
+				des.code[x+j] = src[j].code | src[j].rightpart << 23;
+				des.color[x+j] = c->tint < 0 ? src[j].color : c->tint;
+			}
+			if (c->background) {
+				for (j=0;j<w;j++)
+					des.background[x+j] = src[j].background;
+			}
+			n += w;
+		}
+		des = slotbuffer_offset(des, ctx->width);
+	}
+	*overdraw += hidden;
+	return n;
+}
+
+static int
+cover_spans(struct context *ctx, const struct clip *c, int *overdraw) {
+	const struct body *b = c->sparse;
+	int i,j;
+	int n = 0;
+	struct slotbuffer des = slotbuffer_offset(ctx->s, c->des);
+	uint8_t *cover = ctx->cover + c->des;
+	uint8_t mask = c->background ? COVER_FULL : COVER_GLYPH;
+	for (i=0;i<c->h;i++) {
+		int y = c->src_y + i;
+		const struct span *sp = &b->span[b->row[y]];
+		const struct span *end = &b->span[b->row[y+1]];
+		for (;sp < end;sp++) {
+			const struct slot *src = NULL;
+			int x = 0;
+			int w = clip_span(c, sp, b, &src, &x);
+			for (j=0;j<w;j++) {
+				uint8_t need = mask & ~cover[x+j];
+				if (need & COVER_GLYPH) {
+					des.code[x+j] = src[j].code | src[j].rightpart << 23;
+					des.color[x+j] = c->tint < 0 ? src[j].color : c->tint;
+					++n;
+				} else {
+					++*overdraw;
+				}
+				if (need & COVER_BACKGROUND)
+					des.background[x+j] = src[j].background;
+				cover[x+j] |= need;
+			}
+		}
+		des = slotbuffer_offset(des, ctx->width);
+		cover += ctx->width;
+	}
+	return n;
+}
+
+// Draw the slots [from, to) of a row over the screen, the transparent ones (code 0) are skipped
+static FORCEINLINE int
+blit_row(const struct clip *c, const struct slot *src, struct slotbuffer des, int from, int to, int *hidden) {
+	int j;
+	int n = 0;
+	for (j=from;j<to;j++) {
+		if (src[j].code) {
+			*hidden += des.code[j] != 0;
+			des.code[j] = src[j].code | src[j].rightpart << 23;
+			des.color[j] = c->tint < 0 ? src[j].color : c->tint;
+			if (c->background)
+				des.background[j] = src[j].background;
+			++n;
+		}
+	}
+	return n;
+}
+
+#ifdef RASTER_X86
+
+static const uint8_t popcount4[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+// Test the transparency of 4 slots at once, and blend the opaque ones into the planes
+TARGET_SSE2 static int
+blit_slots_sse2(struct context *ctx, const struct clip *c, int *overdraw) {
+	int i,j;
+	int n = 0;
+	int hidden = 0;
+	const struct slot *src = c->src;
+	struct slotbuffer des = slotbuffer_offset(ctx->s, c->des);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i code_mask = _mm_set1_epi32(0x7fffff);
+	const __m128i slot_mask = _mm_set1_epi32(0xffffff);	// code | rightpart << 23
+	const __m128i tint = _mm_set1_epi16((short)c->tint);
+	for (i=0;i<c->h;i++) {
+		for (j=0;j+4<=c->w;j+=4) {
+			__m128 a = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)&src[j]));
+			__m128 b = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)&src[j+2]));
+			__m128i code = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1)));
+			__m128i keep = _mm_cmpeq_epi32(_mm_and_si128(code, code_mask), zero);
+			int m = _mm_movemask_ps(_mm_castsi128_ps(keep));
+			if (m == 0xf)
+				continue;
+			__m128i old = _mm_loadu_si128((const __m128i *)&des.code[j]);
+			int empty = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(old, zero)));
+			hidden += popcount4[~(m | empty) & 0xf];
+			n += 4 - popcount4[m];
+			code = _mm_and_si128(code, slot_mask);
+			_mm_storeu_si128((__m128i *)&des.code[j], _mm_or_si128(_mm_and_si128(keep, old), _mm_andnot_si128(keep, code)));
+			// background | color << 16 of each slot, gathered into 4 backgrounds and 4 colors
+			__m128i bc = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0)));
+			bc = _mm_shufflelo_epi16(bc, _MM_SHUFFLE(3,1,2,0));
+			bc = _mm_shufflehi_epi16(bc, _MM_SHUFFLE(3,1,2,0));
+			bc = _mm_shuffle_epi32(bc, _MM_SHUFFLE(3,1,2,0));
+			__m128i keep16 = _mm_packs_epi32(keep, keep);
+			__m128i color = c->tint < 0 ? _mm_srli_si128(bc, 8) : tint;
+			old = _mm_loadl_epi64((const __m128i *)&des.color[j]);
+			_mm_storel_epi64((__m128i *)&des.color[j], _mm_or_si128(_mm_and_si128(keep16, old), _mm_andnot_si128(keep16, color)));
+			if (c->background) {
+				old = _mm_loadl_epi64((const __m128i *)&des.background[j]);
+				_mm_storel_epi64((__m128i *)&des.background[j], _mm_or_si128(_mm_and_si128(keep16, old), _mm_andnot_si128(keep16, bc)));
+			}
+		}
+		n += blit_row(c, src, des, j, c->w, &hidden);
+		src += c->pitch;
+		des = slotbuffer_offset(des, ctx->width);
+	}
+	*overdraw += hidden;
+	return n;
+}
+
+#endif
+
+// Draw the clipped slots over the screen, returns the number of glyphs written.
+// *overdraw counts the glyphs overwritten.
+static int
+blit_slots(struct context *ctx, const struct clip *c, int *overdraw) {
+#ifdef RASTER_X86
+	if (ctx->raster.vector)
+		return blit_slots_sse2(ctx, c, overdraw);
+#endif
+	int i;
+	int n = 0;
+	int hidden = 0;
+	const struct slot *src = c->src;
+	struct slotbuffer des = slotbuffer_offset(ctx->s, c->des);
+	for (i=0;i<c->h;i++) {
+		n += blit_row(c, src, des, 0, c->w, &hidden);
+		src += c->pitch;
+		des = slotbuffer_offset(des, ctx->width);
+	}
+	*overdraw += hidden;
+	return n;
+}
+
+// Draw the clipped slots under the slots covered by the upper ones, returns the number of glyphs written.
+// *overdraw counts the glyphs hidden by the upper ones.
+static int
+cover_slots(struct context *ctx, const struct clip *c, int *overdraw) {
+	int i,j;
+	int n = 0;
+	const struct slot *src_slot = c->src;
+	struct slotbuffer des = slotbuffer_offset(ctx->s, c->des);
+	uint8_t *cover = ctx->cover + c->des;
+	uint8_t mask = c->background ? COVER_FULL : COVER_GLYPH;
+	for (i=0;i<c->h;i++) {
+		for (j=0;j<c->w;j++) {
+			const struct slot *src = &src_slot[j];
+			if (src->code == 0)
+				continue;
+			uint8_t need = mask & ~cover[j];
+			if (need & COVER_GLYPH) {
+				des.code[j] = src->code | src->rightpart << 23;
+				des.color[j] = c->tint < 0 ? src->color : c->tint;
+				++n;
+			} else {
+				++*overdraw;
+			}
+			if (need & COVER_BACKGROUND)
+				des.background[j] = src->background;
+			cover[j] |= need;
+		}
+		src_slot += c->pitch;
+		des = slotbuffer_offset(des, ctx->width);
+		cover += ctx->width;
+	}
+	return n;
+}
+
+static int
+draw_sprite(struct context *ctx, struct sprite *spr, int top, int bottom, int *overdraw) {
+	struct clip c;
+	if (!clip_sprite(ctx, spr, top, bottom, &c))
+		return 0;
+	return c.sparse ? blit_spans(ctx, &c, overdraw) : blit_slots(ctx, &c, overdraw);
+}
+
+static int
+cover_sprite(struct context *ctx, struct sprite *spr, int top, int bottom, int *overdraw) {
+	struct clip c;
+	if (!clip_sprite(ctx, spr, top, bottom, &c))
+		return 0;
+	return c.sparse ? cover_spans(ctx, &c, overdraw) : cover_slots(ctx, &c, overdraw);
+}
+
+// The chunk (cx, cy) of the map file, NULL if it's empty (or broken)
+static const struct slot *
+mapfile_chunk(const struct mapfile *m, int cx, int cy) {
+	uint64_t offset = m->index[cy * m->chunks_x + cx];
+	if (offset == 0 || offset % MAPALIGN != 0 || offset > m->map.size || m->map.size - offset < m->chunk_bytes)
+		return NULL;
+	return (const struct slot *)(m->map.data + offset);
+}
+
+// The map file is little endian : a header, the chunk index (an uint64 offset of each chunk in rows, 0 for an empty chunk),
+// then the chunks aligned to MAPALIGN. A chunk is chunk_w * chunk_h slots in rows, 8 bytes each :
+// uint16 background (RGB565), uint16 color (RGB565), uint32 glyph index | rightpart << 23.
+struct mapfile_header {
+	char magic[4];	// "RMAP"
+	uint32_t version;
+	uint32_t width;
+	uint32_t height;
+	uint16_t chunk_w;
+	uint16_t chunk_h;
+	uint32_t reserved[3];
+};
+
+static size_t
+page_size() {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwPageSize;
+#else
+	return sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// The pages in [from, to), a chunk owns its padding to MAPALIGN in the file
+static int
+page_range(uintptr_t from, uintptr_t to, const uint8_t **ptr, size_t *sz) {
+	size_t page = page_size();
+	// Don't touch the pages shared with other chunks, if the page is larger than MAPALIGN
+	from = (from + page - 1) & ~(page - 1);
+	to &= ~(page - 1);
+	if (from >= to)
+		return 0;
+	*ptr = (const uint8_t *)from;
+	*sz = to - from;
+	return 1;
+}
+
+// Drop the pages from the memory, they will be paged in again from the file
+static void
+release_pages(const struct mapfile *m, uint64_t from, uint64_t to) {
+	const uint8_t *p;
+	size_t sz;
+	if (!page_range((uintptr_t)(m->map.data + from), (uintptr_t)(m->map.data + to), &p, &sz))
+		return;
+#ifdef _WIN32
+	// Unlock the pages not locked removes them from the working set
+	VirtualUnlock((LPVOID)p, sz);
+#else
+	madvise((void *)p, sz, MADV_DONTNEED);
+#endif
+}
+
+// Ask the system to read the chunk in the background
+static void
+prefetch_chunk(const struct mapfile *m, int cx, int cy) {
+	const struct slot *s = mapfile_chunk(m, cx, cy);
+	const uint8_t *p;
+	size_t sz;
+	if (s == NULL || !page_range((uintptr_t)s, (uintptr_t)s + m->chunk_bytes, &p, &sz))
+		return;
+#ifdef _WIN32
+#if _WIN32_WINNT >= 0x0602
+	WIN32_MEMORY_RANGE_ENTRY range = { (PVOID)p, sz };
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#else
+	madvise((void *)p, sz, MADV_WILLNEED);
+#endif
+}
+
+// Release all the chunks out of the rect r. The gaps between the chunks in r are released as a whole,
+// because the system may map the neighbors of a faulted page as well.
+static void
+release_chunks(const struct mapfile *m, const int r[4]) {
+	uint64_t offset[MAPRESIDENT];
+	int n = 0;
+	int i,j,k;
+	for (i=r[1];i<r[3];i++) {
+		for (j=r[0];j<r[2];j++) {
+			const struct slot *s = mapfile_chunk(m, j, i);
+			if (s == NULL)
+				continue;
+			if (n >= MAPRESIDENT)
+				return;	// too many chunks on the camera, keep them all
+			uint64_t o = (const uint8_t *)s - m->map.data;
+			for (k=n;k>0 && offset[k-1] > o;k--)
+				offset[k] = offset[k-1];
+			offset[k] = o;
+			++n;
+		}
+	}
+	uint64_t span = (m->chunk_bytes + MAPALIGN - 1) & ~(uint64_t)(MAPALIGN - 1);
+	uint64_t from = (sizeof(struct mapfile_header) + (uint64_t)m->chunks_x * m->chunks_y * sizeof(uint64_t) + MAPALIGN - 1) & ~(uint64_t)(MAPALIGN - 1);
+	for (i=0;i<n;i++) {
+		if (offset[i] > from)
+			release_pages(m, from, offset[i]);
+		from = offset[i] + span;
+	}
+	if (from < m->map.size)
+		release_pages(m, from, m->map.size);
+}
+
+static inline int
+in_rect(const int r[4], int x, int y) {
+	return x >= r[0] && x < r[2] && y >= r[1] && y < r[3];
+}
+
+// Keep the chunks on the camera (and the neighbors if prefetch) resident, release the others
+static void
+page_mapfile(struct context *ctx, struct mapfile *m) {
+	int margin = m->prefetch ? 1 : 0;
+	int r[4];
+	int x0 = ctx->x - m->x;
+	int y0 = ctx->y - m->y;
+	int x1 = x0 + ctx->width;
+	int y1 = y0 + ctx->height;
+	// floor division for the camera out of the map
+	r[0] = (x0 >= 0 ? x0 / m->chunk_w : -1) - margin;
+	r[1] = (y0 >= 0 ? y0 / m->chunk_h : -1) - margin;
+	r[2] = (x1 > 0 ? (x1 - 1) / m->chunk_w + 1 : 0) + margin;
+	r[3] = (y1 > 0 ? (y1 - 1) / m->chunk_h + 1 : 0) + margin;
+	if (r[0] < 0)
+		r[0] = 0;
+	if (r[1] < 0)
+		r[1] = 0;
+	if (r[2] > m->chunks_x)
+		r[2] = m->chunks_x;
+	if (r[3] > m->chunks_y)
+		r[3] = m->chunks_y;
+	if (r[0] > r[2])
+		r[0] = r[2];
+	if (r[1] > r[3])
+		r[1] = r[3];
+	if (memcmp(r, m->resident, sizeof(r)) == 0)
+		return;
+	int i,j;
+	release_chunks(m, r);
+	if (margin) {
+		for (i=r[1];i<r[3];i++) {
+			for (j=r[0];j<r[2];j++) {
+				if (!in_rect(m->resident, j, i))
+					prefetch_chunk(m, j, i);
+			}
+		}
+	}
+	memcpy(m->resident, r, sizeof(r));
+}
+
+static void
+page_mapfiles(struct context *ctx) {
+	struct mapfile *m = ctx->mapfile;
+	if (m == NULL)
+		return;
+	do {
+		page_mapfile(ctx, m);
+		m = m->next;
+	} while (m != ctx->mapfile);
+}
+
+// Draw the chunks of the map file in the rows [top, bottom)
+static int
+draw_mapfile(struct context *ctx, struct mapfile *m, int top, int bottom, int *overdraw) {
+	int cx0 = (ctx->x - m->x) / m->chunk_w;
+	int cy0 = (ctx->y + top - m->y) / m->chunk_h;
+	int cx1 = (ctx->x + ctx->width - 1 - m->x) / m->chunk_w;
+	int cy1 = (ctx->y + bottom - 1 - m->y) / m->chunk_h;
+	if (ctx->x + ctx->width <= m->x || ctx->y + bottom <= m->y || cx0 >= m->chunks_x || cy0 >= m->chunks_y)
+		return 0;
+	if (cx0 < 0)
+		cx0 = 0;
+	if (cy0 < 0)
+		cy0 = 0;
+	if (cx1 >= m->chunks_x)
+		cx1 = m->chunks_x - 1;
+	if (cy1 >= m->chunks_y)
+		cy1 = m->chunks_y - 1;
+	int i,j;
+	int n = 0;
+	for (i=cy0;i<=cy1;i++) {
+		for (j=cx0;j<=cx1;j++) {
+			const struct slot *s = mapfile_chunk(m, j, i);
+			struct clip c;
+			int x = j * m->chunk_w;
+			int y = i * m->chunk_h;
+			int w = m->width - x < m->chunk_w ? m->width - x : m->chunk_w;
+			int h = m->height - y < m->chunk_h ? m->height - y : m->chunk_h;
+			if (s && clip_slots(ctx, s, m->chunk_w, m->x + x, m->y + y, w, h, top, bottom, &c)) {
+				c.background = 1;
+				n += ctx->topdown ? cover_slots(ctx, &c, overdraw) : blit_slots(ctx, &c, overdraw);
+			}
+		}
+	}
+	return n;
+}
+
+// Compose the rows [top, bottom) from the bottom layer up, the upper sprites overwrite the lower
+static void
+compose_painter(struct context *ctx, int top, int bottom) {
+	int offset = top * ctx->width;
+	int n = ctx->width * (bottom - top);
+	memset(ctx->s.code + offset, 0, n * sizeof(uint32_t));
+	memset(ctx->s.color + offset, 0, n * sizeof(uint16_t));
+	memset(ctx->s.background + offset, 0, n * sizeof(uint16_t));
+	int i;
+	int writes = 0;
+	int overdraw = 0;
+	struct mapfile *f = ctx->mapfile;
+	if (f) {
+		do {
+			writes += draw_mapfile(ctx, f, top, bottom, &overdraw);
+			f = f->next;
+		} while (f != ctx->mapfile);
+	}
+	struct sprite *m = ctx->tilemap;
+	if (m) {
+		do {
+			writes += draw_sprite(ctx, m, top, bottom, &overdraw);
+			m = m->next;
+		} while (m != ctx->tilemap);
+	}
+	for (i=0;i<ctx->visible_n;i++) {
+		writes += draw_sprite(ctx, ctx->visible[i], top, bottom, &overdraw);
+	}
+	SDL_AtomicAdd(&ctx->cell_writes, writes);
+	SDL_AtomicAdd(&ctx->overdraw, overdraw);
+}
+
+// Compose the rows [top, bottom) from the top layer down, each slot is written once
+static void
+compose_topdown(struct context *ctx, int top, int bottom) {
+	int offset = top * ctx->width;
+	int n = ctx->width * (bottom - top);
+	uint8_t *cover = ctx->cover + offset;
+	memset(cover, 0, n);
+	int i;
+	int writes = 0;
+	int overdraw = 0;
+	for (i=ctx->visible_n-1;i>=0;i--) {
+		writes += cover_sprite(ctx, ctx->visible[i], top, bottom, &overdraw);
+	}
+	struct sprite *m = ctx->tilemap;
+	if (m) {
+		do {
+			m = m->prev;
+			writes += cover_sprite(ctx, m, top, bottom, &overdraw);
+		} while (m != ctx->tilemap);
+	}
+	struct mapfile *f = ctx->mapfile;
+	if (f) {
+		do {
+			f = f->prev;
+			writes += draw_mapfile(ctx, f, top, bottom, &overdraw);
+		} while (f != ctx->mapfile);
+	}
+	// Clear the slots not covered
+	struct slotbuffer s = slotbuffer_offset(ctx->s, offset);
+	for (i=0;i<n;i++) {
+		if (!(cover[i] & COVER_GLYPH)) {
+			s.code[i] = 0;
+			s.color[i] = 0;
+		}
+		if (!(cover[i] & COVER_BACKGROUND))
+			s.background[i] = 0;
+	}
+	SDL_AtomicAdd(&ctx->cell_writes, writes);
+	SDL_AtomicAdd(&ctx->overdraw, overdraw);
+}
+
+static void
+draw_sprites(struct context *ctx, int top, int bottom) {
+	if (ctx->topdown)
+		compose_topdown(ctx, top, bottom);
+	else
+		compose_painter(ctx, top, bottom);
+}
+
+static inline void
+tile_range(struct context *ctx, int tile, int *top, int *bottom) {
+	*top = tile * ctx->tile_rows;
+	*bottom = *top + ctx->tile_rows;
+	if (*bottom > ctx->height)
+		*bottom = ctx->height;
+}
+
+// Draw the slots of the rows [top, bottom) changed since the last frame, and mark the changed rows
+static inline void
+flush_rows(struct context *ctx, struct glyph_cache *c, int top, int bottom) {
+	struct frame *f = &ctx->f;
+	int offset = top * ctx->width;
+	ctx->raster.flush(c, &ctx->raster, f->pixels + (top - f->from) * ctx->raster.cell_h * ctx->raster.zoom * f->pitch, f->pitch,
+		slotbuffer_offset(f->s, offset), slotbuffer_offset(f->last, offset), ctx->width, bottom - top, f->dirty, ctx->changed + top);
+}
+
+static void
+mark_changed(struct context *ctx, int top, int bottom) {
+	struct frame *f = &ctx->f;
+	int i;
+	int w = ctx->width;
+	struct slotbuffer s = slotbuffer_offset(f->s, top * w);
+	struct slotbuffer last = slotbuffer_offset(f->last, top * w);
+	for (i=top;i<bottom;i++) {
+		ctx->changed[i] = f->dirty || row_changed(&s, &last, w);
+		s = slotbuffer_offset(s, w);
+		last = slotbuffer_offset(last, w);
+	}
+}
+
+// Compose the tile and draw the changed slots
+static void
+draw_tile(struct context *ctx, struct glyph_cache *c, int tile) {
+	int top, bottom;
+	tile_range(ctx, tile, &top, &bottom);
+	draw_sprites(ctx, top, bottom);
+	flush_rows(ctx, c, top, bottom);
+}
+
+// Compose the tile and mark the changed rows
+static void
+compose_tile(struct context *ctx, int tile) {
+	int top, bottom;
+	tile_range(ctx, tile, &top, &bottom);
+	draw_sprites(ctx, top, bottom);
+	mark_changed(ctx, top, bottom);
+}
+
+// Draw the composed tile, in the rows [from, to) of the frame
+static void
+flush_tile(struct context *ctx, struct glyph_cache *c, int tile) {
+	int top, bottom;
+	tile_range(ctx, tile, &top, &bottom);
+	if (top < ctx->f.from)
+		top = ctx->f.from;
+	if (bottom > ctx->f.to)
+		bottom = ctx->f.to;
+	if (top < bottom)
+		flush_rows(ctx, c, top, bottom);
+}
+
+// c is the glyph cache of the worker, composing doesn't use it
+static void
+run_tile(struct context *ctx, struct glyph_cache *c, int job, int tile) {
+	switch (job) {
+	case TILE_DRAW:
+		draw_tile(ctx, c, tile);
+		break;
+	case TILE_COMPOSE:
+		compose_tile(ctx, tile);
+		break;
+	default:
+		flush_tile(ctx, c, tile);
+		break;
+	}
+}
+
+static void
+run_tiles(struct context *ctx, int job) {
+	int ntiles = (ctx->height + ctx->tile_rows - 1) / ctx->tile_rows;
+	if (ctx->pool) {
+		pool_run(ctx->pool, job, ntiles);
+	} else {
+		int i;
+		for (i=0;i<ntiles;i++) {
+			run_tile(ctx, ctx->cache, job, i);
+		}
+	}
+}
+
+static inline void
+begin_frame(struct context *ctx) {
+	ctx->f.s = ctx->s;
+	ctx->f.last = ctx->last;
+	ctx->f.dirty = ctx->dirty;
+}
+
+// The slots of this frame become the last frame
+static void
+next_slotbuffer(struct context *ctx) {
+	struct slotbuffer tmp = ctx->last;
+	ctx->last = ctx->s;
+	if (ctx->spare.code) {
+		// The last two frames may be still drawing in the pipeline
+		ctx->s = ctx->spare;
+		ctx->spare = tmp;
+	} else {
+		ctx->s = tmp;
+	}
+	ctx->dirty = 0;
+}
+
+// Merge the changed rows into bands, returns the number of bands
+static int
+changed_bands(struct context *ctx) {
+	int i;
+	int n = 0;
+	int band = 0;
+	int zoom = ctx->raster.zoom;
+	SDL_Rect *rect = ctx->rects;
+	for (i=0;i<ctx->height;i++) {
+		if (ctx->changed[i]) {
+			if (band) {
+				rect[n-1].h += ctx->raster.cell_h * zoom;
+			} else {
+				rect[n].x = 0;
+				rect[n].y = i * ctx->raster.cell_h * zoom;
+				rect[n].w = ctx->width * ctx->raster.cell_w * zoom;
+				rect[n].h = ctx->raster.cell_h * zoom;
+				++n;
+			}
+		}
+		band = ctx->changed[i];
+	}
+	return n;
+}
+
+// The largest integer scale factor fits the output of w * h pixels
+static int
+fit_zoom(struct context *ctx, int w, int h) {
+	int zx = w / (ctx->width * ctx->raster.cell_w);
+	int zy = h / (ctx->height * ctx->raster.cell_h);
+	int zoom = zx < zy ? zx : zy;
+	if (zoom < 1)
+		zoom = 1;
+	else if (zoom > MAXZOOM)
+		zoom = MAXZOOM;
+	return zoom;
+}
+
+// Lock the target surface of the frame
+static void
+acquire_surface(lua_State *L, struct context *ctx) {
+	SDL_Surface *ws = SDL_GetWindowSurface(ctx->window);
+	if (ws == NULL)
+		luaL_error(L, "Get window surface failed : %s", SDL_GetError());
+
+	int zoom = fit_zoom(ctx, ws->w, ws->h);
+	if (zoom != ctx->raster.zoom) {
+		ctx->raster.zoom = zoom;
+		if (ctx->surface) {
+			SDL_FreeSurface(ctx->surface);
+			ctx->surface = NULL;
+		}
+		ctx->target = NULL;
+	}
+
+	// Draw into the window surface directly if it's the same size and format
+	SDL_Surface *target = ws;
+	if (ws->w != ctx->width * ctx->raster.cell_w * zoom || ws->h != ctx->height * ctx->raster.cell_h * zoom || ws->format->format != ctx->format) {
+		target = get_surface(L, ctx);
+	}
+	if (target != ctx->target) {
+		ctx->target = target;
+		ctx->dirty = 1;
+	}
+	ctx->window_surface = ws;
+	SDL_LockSurface(target);
+	ctx->f.pixels = target->pixels;
+	ctx->f.pitch = target->pitch;
+	ctx->f.from = 0;
+	ctx->f.to = ctx->height;
+	ctx->f.dirty = ctx->dirty;
+}
+
+static void
+present_surface(struct context *ctx) {
+	SDL_Surface *ws = ctx->window_surface;
+	SDL_Surface *target = ctx->target;
+	SDL_UnlockSurface(target);
+	if (ctx->dirty) {
+		// The window is changed since the frame began, it will be redrawn next frame
+		return;
+	}
+
+	int n = changed_bands(ctx);
+	if (n == 0)
+		return;
+
+	if (ws->w == target->w && ws->h == target->h) {
+		if (target != ws) {
+			int i;
+			for (i=0;i<n;i++) {
+				SDL_Rect r = ctx->rects[i];
+				SDL_BlitSurface(target, &ctx->rects[i], ws, &r);
+			}
+		}
+		SDL_UpdateWindowSurfaceRects(ctx->window, ctx->rects, n);
+	} else {
+		// The window is not an integer multiple of the screen, the rest fractional scale is unavoidable
+		SDL_BlitScaled(target, NULL, ws, NULL);
+		SDL_UpdateWindowSurface(ctx->window);
+	}
+}
+
+// Lock the changed rows of the texture, ctx->changed should be marked
+static void
+acquire_texture(lua_State *L, struct context *ctx) {
+	struct frame *f = &ctx->f;
+	int i;
+	f->from = f->to = 0;
+	for (i=0;i<ctx->height;i++) {
+		if (ctx->changed[i]) {
+			if (f->to == 0)
+				f->from = i;
+			f->to = i + 1;
+		}
+	}
+	if (f->to == 0)
+		return;
+	// The locked pixels are write only, so redraw every slot of the locked rows
+	f->dirty = 1;
+	int zoom = ctx->raster.zoom;
+	SDL_Rect rect = { 0, f->from * ctx->raster.cell_h * zoom, ctx->width * ctx->raster.cell_w * zoom, (f->to - f->from) * ctx->raster.cell_h * zoom };
+	void *pixels;
+	if (SDL_LockTexture(ctx->texture, &rect, &pixels, &f->pitch) != 0)
+		luaL_error(L, "Lock texture failed : %s", SDL_GetError());
+	f->pixels = pixels;
+}
+
+// Recreate the texture at the integer scale factor fits the output, before the frame begins
+static void
+fit_texture(lua_State *L, struct context *ctx) {
+	int w, h;
+	if (SDL_GetRendererOutputSize(ctx->renderer, &w, &h) != 0)
+		return;
+	int zoom = fit_zoom(ctx, w, h);
+	if (zoom == ctx->raster.zoom)
+		return;
+	SDL_Texture *tex = SDL_CreateTexture(ctx->renderer, ctx->format, SDL_TEXTUREACCESS_STREAMING,
+		ctx->width * ctx->raster.cell_w * zoom, ctx->height * ctx->raster.cell_h * zoom);
+	if (tex == NULL)
+		luaL_error(L, "Couldn't create texture: %s", SDL_GetError());
+	SDL_DestroyTexture(ctx->texture);
+	ctx->texture = tex;
+	ctx->raster.zoom = zoom;
+	ctx->dirty = 1;
+}
+
+static void
+present_texture(struct context *ctx) {
+	if (ctx->f.to > 0)
+		SDL_UnlockTexture(ctx->texture);
+
+	SDL_RenderClear(ctx->renderer);
+	SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, NULL);
+	SDL_RenderPresent(ctx->renderer);
+}
+
+static void
+flip_surface(lua_State *L, struct context *ctx) {
+	begin_frame(ctx);
+	acquire_surface(L, ctx);
+	run_tiles(ctx, TILE_DRAW);
+	next_slotbuffer(ctx);
+	present_surface(ctx);
+}
+
+static void
+flip_texture(lua_State *L, struct context *ctx) {
+	fit_texture(L, ctx);
+	begin_frame(ctx);
+	run_tiles(ctx, TILE_COMPOSE);
+	acquire_texture(L, ctx);
+	run_tiles(ctx, TILE_FLUSH);
+	next_slotbuffer(ctx);
+	present_texture(ctx);
+}
+
+static int
+render_thread(void *ud) {
+	struct context *ctx = (struct context *)ud;
+	struct pipeline *p = &ctx->pipeline;
+	for (;;) {
+		SDL_SemWait(p->start);
+		if (p->quit)
+			break;
+		run_tiles(ctx, TILE_FLUSH);
+		SDL_SemPost(p->done);
+	}
+	return 0;
+}
+
+// Wait the render thread, returns 1 if there is a frame drawn to present
+static int
+pipeline_wait(struct context *ctx) {
+	struct pipeline *p = &ctx->pipeline;
+	if (!p->busy)
+		return 0;
+	SDL_SemWait(p->done);
+	p->busy = 0;
+	return 1;
+}
+
+// Compose this frame, present the last frame, and hand this frame to the render thread
+static void
+flip_pipeline(lua_State *L, struct context *ctx) {
+	struct pipeline *p = &ctx->pipeline;
+	draw_sprites(ctx, 0, ctx->height);
+	if (pipeline_wait(ctx)) {
+		if (ctx->texture)
+			present_texture(ctx);
+		else
+			present_surface(ctx);
+	}
+	if (ctx->texture)
+		fit_texture(L, ctx);
+	begin_frame(ctx);
+	if (ctx->texture) {
+		mark_changed(ctx, 0, ctx->height);
+		acquire_texture(L, ctx);
+	} else {
+		acquire_surface(L, ctx);
+	}
+	p->busy = 1;
+	SDL_SemPost(p->start);
+	next_slotbuffer(ctx);
+}
+
+// Unlock the target of the frame left by acquire_surface or acquire_texture, without presenting it
+static void
+unlock_target(struct context *ctx) {
+	if (ctx->texture) {
+		if (ctx->f.to > 0)
+			SDL_UnlockTexture(ctx->texture);
+	} else if (ctx->target) {
+		SDL_UnlockSurface(ctx->target);
+	}
+}
+
+static void
+release_pipeline(struct context *ctx) {
+	struct pipeline *p = &ctx->pipeline;
+	if (p->thread) {
+		// The target of the frame in the render thread is locked until it's presented
+		if (pipeline_wait(ctx))
+			unlock_target(ctx);
+		p->quit = 1;
+		SDL_SemPost(p->start);
+		SDL_WaitThread(p->thread, NULL);
+		p->thread = NULL;
+	}
+	if (p->start) {
+		SDL_DestroySemaphore(p->start);
+		p->start = NULL;
+	}
+	if (p->done) {
+		SDL_DestroySemaphore(p->done);
+		p->done = NULL;
+	}
+}
+
+static void
+init_pipeline(lua_State *L, struct context *ctx) {
+	struct pipeline *p = &ctx->pipeline;
+	p->start = SDL_CreateSemaphore(0);
+	p->done = SDL_CreateSemaphore(0);
+	if (p->start == NULL || p->done == NULL)
+		luaL_error(L, "Create semaphore failed : %s", SDL_GetError());
+	p->thread = SDL_CreateThread(render_thread, "render", ctx);
+	if (p->thread == NULL)
+		luaL_error(L, "Create thread failed : %s", SDL_GetError());
+}
+
+// Append the sprite to the culled ones, and compare it with the one culled at the same place last frame
+static void
+add_visible(lua_State *L, struct context *ctx, struct sprite *spr) {
+	if (ctx->culled_n >= ctx->visible_cap) {
+		int cap = ctx->visible_cap * 2;
+		if (cap < 256)
+			cap = 256;
+		// The culled and the visible arrays in one userdata, the new part of culled is zero so it's reordered
+		struct culled *c = (struct culled *)lua_newuserdatauv(L, cap * (sizeof(struct culled) + sizeof(struct sprite *)), 0);
+		memset(c, 0, cap * sizeof(struct culled));
+		if (ctx->culled_n > 0)
+			memcpy(c, ctx->culled, ctx->culled_n * sizeof(struct culled));
+		ctx->culled = c;
+		ctx->visible = (struct sprite **)(c + cap);
+		ctx->visible_cap = cap;
+		lua_setiuservalue(L, lua_upvalueindex(1), 4);
+	}
+	struct culled *c = &ctx->culled[ctx->culled_n++];
+	uint64_t order = (uint64_t)spr->layer << 56 | spr->serial;
+	if (c->spr != spr || c->order != order) {
+		c->spr = spr;
+		c->order = order;
+		ctx->reorder = 1;
+	}
+}
+
+static inline int
+sprite_on_camera(struct context *ctx, struct sprite *spr) {
+	int x = spr->x - spr->kx;
+	int y = spr->y - spr->ky;
+	return x < ctx->x + ctx->width && x + (int)spr->w > ctx->x
+		&& y < ctx->y + ctx->height && y + (int)spr->h > ctx->y;
+}
+
+// Add the sprites of the bucket b on the camera, the ones on the hidden layers are skipped before the camera test
+static void
+cull_bucket(lua_State *L, struct context *ctx, int b) {
+	struct sprite *head = ctx->bucket[b];
+	if (head == NULL)
+		return;
+	struct sprite *spr = head;
+	do {
+		if (ctx->layer[spr->layer] == 0 && sprite_on_camera(ctx, spr))
+			add_visible(L, ctx, spr);
+		spr = spr->next;
+	} while (spr != head);
+}
+
+static void
+cull_pool(lua_State *L, struct context *ctx) {
+	struct spritepool *p = &ctx->sprites;
+	int i;
+	for (i=0;i<p->top;i++) {
+		struct sprite *spr = &p->sprite[i];
+		if (p->state[i] == SPRITE_VISIBLE && ctx->layer[spr->layer] == 0 && sprite_on_camera(ctx, spr))
+			add_visible(L, ctx, spr);
+	}
+}
+
+static int
+sprite_order(const void *a, const void *b) {
+	const struct sprite *sa = *(const struct sprite **)a;
+	const struct sprite *sb = *(const struct sprite **)b;
+	if (sa->layer != sb->layer)
+		return sa->layer < sb->layer ? -1 : 1;
+	return sa->serial < sb->serial ? -1 : (sa->serial > sb->serial);
+}
+
+// Collect the sprites intersect the camera from the spatial index, in painter's order (layer, then creation).
+// They are sorted only if they aren't the same ones (in the same buckets, with the same layers) of the last frame.
+static void
+cull_sprites(lua_State *L, struct context *ctx) {
+	int last_n = ctx->culled_n;
+	ctx->culled_n = 0;
+	// The top left corner of a sprite on the camera is at most a cell before the camera
+	int cx0 = (ctx->x - CELLSIZE + 1) >> CELLSHIFT;
+	int cy0 = (ctx->y - CELLSIZE + 1) >> CELLSHIFT;
+	int cx1 = (ctx->x + ctx->width - 1) >> CELLSHIFT;
+	int cy1 = (ctx->y + ctx->height - 1) >> CELLSHIFT;
+	// Visit each bucket once, even if the cells wrap around the grid. The sprites of other cells in the bucket are culled by the camera.
+	int nx = cx1 - cx0 + 1;
+	int ny = cy1 - cy0 + 1;
+	if (nx > SPRITEGRID)
+		nx = SPRITEGRID;
+	if (ny > SPRITEGRID)
+		ny = SPRITEGRID;
+	int i,j;
+	for (i=0;i<ny;i++) {
+		int row = ((cy0 + i) & (SPRITEGRID - 1)) * SPRITEGRID;
+		for (j=0;j<nx;j++) {
+			cull_bucket(L, ctx, row + ((cx0 + j) & (SPRITEGRID - 1)));
+		}
+	}
+	cull_bucket(L, ctx, SPRITEGRID * SPRITEGRID);
+	cull_pool(L, ctx);
+	if (ctx->culled_n != last_n)
+		ctx->reorder = 1;
+	if (!ctx->reorder)
+		return;
+	ctx->reorder = 0;
+	for (i=0;i<ctx->culled_n;i++) {
+		ctx->visible[i] = ctx->culled[i].spr;
+	}
+	ctx->visible_n = ctx->culled_n;
+	if (ctx->visible_n > 1)
+		qsort(ctx->visible, ctx->visible_n, sizeof(struct sprite *), sprite_order);
+}
+
+// Sleep until spin ms before the deadline, and yield the rest
+static void
+wait_until(uint64_t deadline, uint64_t freq, int spin_ms) {
+	uint64_t spin = freq * spin_ms / 1000;
+	uint64_t c = SDL_GetPerformanceCounter();
+	if (c + spin < deadline)
+		SDL_Delay((uint32_t)((deadline - spin - c) * 1000 / freq));
+	while (SDL_GetPerformanceCounter() < deadline)
+		SDL_Delay(0);
+}
+
+// The deadlines are computed from frame 0 of each second, so they don't drift for any fps
+static void
+pace_frame(struct context *ctx) {
+	uint64_t freq = SDL_GetPerformanceFrequency();
+	uint64_t c = SDL_GetPerformanceCounter();
+	int frame = ctx->frame + 1;
+	uint64_t deadline = ctx->tick + frame * freq / ctx->fps;
+	if (frame >= ctx->fps) {
+		ctx->tick = deadline;
+		frame = 0;
+	}
+	ctx->frame = frame;
+	if (c < deadline) {
+		wait_until(deadline, freq, ctx->spin);
+	} else {
+		++ctx->missed;
+		if (c - deadline > freq) {
+			// reset frame count if the error is too large
+			ctx->tick = c;
+			ctx->frame = 0;
+		}
+	}
+	c = SDL_GetPerformanceCounter();
+	if (ctx->last_tick) {
+		ctx->frame_time[ctx->frame_n++ % FRAMESTAT] = (uint32_t)((c - ctx->last_tick) * 1000000 / freq);
+	}
+	ctx->last_tick = c;
+}
+
+static int
+lframe(lua_State *L) {
+	struct context * ctx = getCtx(L);
+	if (ctx->window == NULL)
+		return luaL_error(L, "Init first");
+	ctx->x = luaL_optinteger(L, 1, 0);
+	ctx->y = luaL_optinteger(L, 2, 0);
+	cull_sprites(L, ctx);
+	page_mapfiles(ctx);
+	SDL_AtomicSet(&ctx->cell_writes, 0);
+	SDL_AtomicSet(&ctx->overdraw, 0);
+	if (ctx->pipeline.thread)
+		flip_pipeline(L, ctx);
+	else if (ctx->texture)
+		flip_texture(L, ctx);
+	else
+		flip_surface(L, ctx);
+	pace_frame(ctx);
+	return 0;
+}
+
+static void
+resize_window(struct context *ctx, int width, int height) {
+	int ow = ctx->width * ctx->raster.cell_w;
+	int oh = ctx->height * ctx->raster.cell_h;
+	if (ow * height == oh * width) {
+		ctx->w = width;
+		ctx->h = height;
+		return;
+	}
+	if (width > ctx->w) {
+		// enlarge width
+		height = oh * width / ow;
+	} else if (height > ctx->h) {
+		// enlarge height
+		width = ow * height / oh;
+	} else if (width < ctx->w) {
+		// shrink width
+		height = oh * width / ow;
+	} else {
+		// shrink height
+		width = ow * height / oh;
+	}
+
+	ctx->w = width;
+	ctx->h = height;
+
+	SDL_SetWindowSize(ctx->window, width, height);
+}
+
+static void
+winevent(lua_State *L, SDL_Event *ev) {
+	struct context * ctx = getCtx(L);
+	switch (ev->window.event) {
+		case SDL_WINDOWEVENT_SIZE_CHANGED :
+			resize_window(ctx, ev->window.data1, ev->window.data2);
+			ctx->dirty = 1;
+			break;
+		case SDL_WINDOWEVENT_EXPOSED :
+			ctx->dirty = 1;
+			break;
+	}
+}
+
+static int
+keyevent(lua_State *L, SDL_Event *ev) {
+//	if (ev->key.repeat)
+//		return 0;
+	lua_pushstring(L, "KEY");
+	lua_pushstring(L, SDL_GetKeyName(ev->key.keysym.sym));
+	lua_pushboolean(L, ev->key.type == SDL_KEYDOWN);
+	return 3;
+}
+
+static void
+screen_coord(struct context *ctx, int *x, int *y) {
+	if (ctx->renderer == NULL) {
+		// The window surface isn't scaled by the renderer's logical size
+		*x = *x * ctx->width * ctx->raster.cell_w / ctx->w;
+		*y = *y * ctx->height * ctx->raster.cell_h / ctx->h;
+	}
+	*x /= ctx->raster.cell_w;
+	*y /= ctx->raster.cell_h;
+}
+
+static int
+motionevent(lua_State *L, SDL_Event *ev) {
+	struct context * ctx = getCtx(L);
+	int x = ev->motion.x;
+	int y = ev->motion.y;
+	screen_coord(ctx, &x, &y);
+	if (x == ctx->mousex && y == ctx->mousey)
+		return 0;
+	ctx->mousex = x;
+	ctx->mousey = y;
+	lua_pushstring(L, "MOTION");
+	lua_pushinteger(L, x);
+	lua_pushinteger(L, y);
+	return 3;
+}
+
+static int
+buttonevent(lua_State *L, SDL_Event *ev) {
+	struct context * ctx = getCtx(L);
+	int x = ev->motion.x;
+	int y = ev->motion.y;
+	screen_coord(ctx, &x, &y);
+	ctx->mousex = x;
+	ctx->mousey = y;
+	lua_pushstring(L, "BUTTON");
+	lua_pushinteger(L, x);
+	lua_pushinteger(L, y);
+	lua_pushinteger(L, ev->button.button);
+	lua_pushboolean(L, ev->button.state == SDL_PRESSED);
+	lua_pushinteger(L, ev->button.clicks);
+	return 6;
+}
+
+static int
+levent(lua_State *L) {
+	SDL_Event event;
+
+	int r;
+
+	while (SDL_PollEvent(&event)) {
+		switch (event.type)	{
+			case SDL_QUIT:
+				lua_pushstring(L, "QUIT");
+				return 1;
+			case SDL_WINDOWEVENT:
+				winevent(L, &event);
+				break;
+			case SDL_KEYDOWN:
+			case SDL_KEYUP:
+				if ((r = keyevent(L, &event)) > 0)
+					return r;
+				break;
+			case SDL_TEXTEDITING:
+				SDL_StopTextInput();
+				break;
+			case SDL_MOUSEMOTION:
+				if ((r = motionevent(L, &event)) > 0)
+					return r;
+				break;
+			case SDL_MOUSEBUTTONDOWN:
+			case SDL_MOUSEBUTTONUP:
+				return buttonevent(L, &event);
+			default:
+				break;
+		}
+	}
+	return 0;
+}
+
+static struct sprite *
+getSpr(lua_State *L) {
+	struct sprite *spr = lua_touserdata(L, 1);
+	if (spr == NULL)
+		luaL_error(L, "Need sprite");
+	return spr;
+}
+
+
+static inline int
+sprite_bucket(struct sprite *spr) {
+	if (spr->w > CELLSIZE || spr->h > CELLSIZE)
+		return SPRITEGRID * SPRITEGRID;
+	int cx = (spr->x - spr->kx) >> CELLSHIFT;
+	int cy = (spr->y - spr->ky) >> CELLSHIFT;
+	return (cy & (SPRITEGRID - 1)) * SPRITEGRID + (cx & (SPRITEGRID - 1));
+}
+
+// Append spr to the circular list
+static void
+list_link(struct sprite **head, struct sprite *spr) {
+	struct sprite * node = *head;
+	if (node == NULL) {
+		spr->prev = spr->next = spr;
+		*head = spr;
+	} else {
+		// insert before node
+		spr->next = node;
+		spr->prev = node->prev;
+
+		node->prev = spr;
+		spr->prev->next = spr;
+	}
+}
+
+static void
+list_unlink(struct sprite **head, struct sprite *spr) {
+	if (*head == spr) {
+		if (spr->next == spr) {
+			*head = NULL;
+		} else {
+			*head = spr->next;
+		}
+	}
+	struct sprite *prev = spr->prev;
+	struct sprite *next = spr->next;
+	prev->next = next;
+	next->prev = prev;
+	spr->prev = NULL;
+	spr->next = NULL;
+}
+
+static void
+link_sprite(struct context *ctx, struct sprite *spr) {
+	spr->bucket = sprite_bucket(spr);
+	list_link(&ctx->bucket[spr->bucket], spr);
+}
+
+static void
+unlink_sprite(struct context *ctx, struct sprite *spr) {
+	list_unlink(&ctx->bucket[spr->bucket], spr);
+}
+
+static void
+move_sprite(struct context *ctx, struct sprite *spr, int x, int y) {
+	spr->x = x;
+	spr->y = y;
+	if (spr->prev && sprite_bucket(spr) != spr->bucket) {
+		unlink_sprite(ctx, spr);
+		link_sprite(ctx, spr);
+	}
+}
+
+static int
+lsetpos(lua_State *L) {
+	struct sprite *spr = getSpr(L);
+	move_sprite(getCtx(L), spr, luaL_checkinteger(L, 2), luaL_checkinteger(L, 3));
+	return 0;
+}
+
+static void
+set_visible(struct context *ctx, struct sprite *spr, int visible) {
+	if (spr->bucket == POOLED) {
+		ctx->sprites.state[spr - ctx->sprites.sprite] = visible ? SPRITE_VISIBLE : SPRITE_HIDDEN;
+		return;
+	}
+	if (visible) {
+		if (spr->prev == NULL)
+			link_sprite(ctx, spr);
+	} else {
+		if (spr->prev)
+			unlink_sprite(ctx, spr);
+	}
+}
+
+static int
+lvisible(lua_State *L) {
+	struct sprite *spr = getSpr(L);
+	set_visible(getCtx(L), spr, lua_toboolean(L, 2));
+	return 0;
+}
+
+static struct sprite *
+pool_sprite(lua_State *L, struct context *ctx, lua_Integer handle) {
+	struct spritepool *p = &ctx->sprites;
+	if (handle <= 0 || handle > p->top || p->state[handle-1] == SPRITE_FREE)
+		luaL_error(L, "Invalid sprite handle %d", (int)handle);
+	return &p->sprite[handle-1];
+}
+
+// c.spawn(sprite [, visible]) returns a handle of a copy of the sprite in the pool, it shares the body of the sprite
+static int
+lspawn(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	struct sprite *spr = (struct sprite *)luaL_checkudata(L, 1, "RSPRITE");
+	int visible = lua_isnoneornil(L, 2) ? spr->prev != NULL : lua_toboolean(L, 2);
+	int id = spritepool_alloc(&ctx->sprites);
+	if (id < 0)
+		return luaL_error(L, "The sprite pool is full (%d)", ctx->sprites.cap);
+	struct sprite *s = &ctx->sprites.sprite[id];
+	*s = *spr;
+	s->prev = NULL;
+	s->next = NULL;
+	s->bucket = POOLED;
+	s->serial = ctx->serial++;
+	++s->body->ref;
+	lua_getiuservalue(L, lua_upvalueindex(1), 6);
+	lua_getiuservalue(L, 1, 1);
+	lua_rawseti(L, -2, id + 1);
+	set_visible(ctx, s, visible);
+	lua_pushinteger(L, id + 1);
+	return 1;
+}
+
+// c.despawn(handle) releases the sprite, the handle may be reused by c.spawn
+static int
+ldespawn(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	lua_Integer handle = luaL_checkinteger(L, 1);
+	struct sprite *s = pool_sprite(L, ctx, handle);
+	--s->body->ref;
+	s->body = NULL;
+	spritepool_free(&ctx->sprites, handle - 1);
+	lua_getiuservalue(L, lua_upvalueindex(1), 6);
+	lua_pushnil(L);
+	lua_rawseti(L, -2, handle);
+	return 0;
+}
+
+// c.move(handle, x, y)
+static int
+lmove(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	struct sprite *s = pool_sprite(L, ctx, luaL_checkinteger(L, 1));
+	s->x = luaL_checkinteger(L, 2);
+	s->y = luaL_checkinteger(L, 3);
+	return 0;
+}
+
+// c.show(handle, visible)
+static int
+lshow(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	struct sprite *s = pool_sprite(L, ctx, luaL_checkinteger(L, 1));
+	set_visible(ctx, s, lua_toboolean(L, 2));
+	return 0;
+}
+
+// The i-th sprite (or handle) of the array at index 1, for the batched functions
+static struct sprite *
+batch_sprite(lua_State *L, int i) {
+	if (lua_rawgeti(L, 1, i) == LUA_TNUMBER) {
+		struct sprite *spr = pool_sprite(L, getCtx(L), lua_tointeger(L, -1));
+		lua_pop(L, 1);
+		return spr;
+	}
+	struct sprite *spr = (struct sprite *)luaL_testudata(L, -1, "RSPRITE");
+	if (spr == NULL)
+		luaL_error(L, "sprites[%d] is not a sprite", i);
+	lua_pop(L, 1);	// still referenced by the array
+	return spr;
+}
+
+static lua_Integer
+batch_integer(lua_State *L, int idx, int i) {
+	lua_rawgeti(L, idx, i);
+	int isnum;
+	lua_Integer v = lua_tointegerx(L, -1, &isnum);
+	if (!isnum)
+		luaL_error(L, "[%d] should be an integer", i);
+	lua_pop(L, 1);
+	return v;
+}
+
+// c.setpos_many(sprites, coords) moves sprites[i] to the i-th (x, y) of coords,
+// coords is a string of packed int32 pairs (string.pack "i4i4" ...) or an array of integers { x1, y1, x2, y2, ... }
+static int
+lsetpos_many(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	luaL_checktype(L, 1, LUA_TTABLE);
+	int n = (int)lua_rawlen(L, 1);
+	int i;
+	if (lua_type(L, 2) == LUA_TSTRING) {
+		size_t sz;
+		const char *coords = lua_tolstring(L, 2, &sz);
+		if (sz < (size_t)n * 2 * sizeof(int32_t))
+			return luaL_error(L, "Need %d coords, only %d", n, (int)(sz / (2 * sizeof(int32_t))));
+		for (i=0;i<n;i++) {
+			int32_t xy[2];
+			memcpy(xy, coords + i * sizeof(xy), sizeof(xy));
+			move_sprite(ctx, batch_sprite(L, i+1), xy[0], xy[1]);
+		}
+	} else {
+		luaL_checktype(L, 2, LUA_TTABLE);
+		for (i=0;i<n;i++) {
+			struct sprite *spr = batch_sprite(L, i+1);
+			int x = batch_integer(L, 2, i*2+1);
+			int y = batch_integer(L, 2, i*2+2);
+			move_sprite(ctx, spr, x, y);
+		}
+	}
+	return 0;
+}
+
+// c.visible_many(sprites, visible) shows/hides all the sprites, or sprites[i] by visible[i] if it's an array
+static int
+lvisible_many(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	luaL_checktype(L, 1, LUA_TTABLE);
+	int n = (int)lua_rawlen(L, 1);
+	int i;
+	if (lua_type(L, 2) == LUA_TTABLE) {
+		for (i=0;i<n;i++) {
+			struct sprite *spr = batch_sprite(L, i+1);
+			lua_rawgeti(L, 2, i+1);
+			set_visible(ctx, spr, lua_toboolean(L, -1));
+			lua_pop(L, 1);
+		}
+	} else {
+		int visible = lua_toboolean(L, 2);
+		for (i=0;i<n;i++) {
+			set_visible(ctx, batch_sprite(L, i+1), visible);
+		}
+	}
+	return 0;
+}
+
+// The layers out of 0..255 are clamped, the same as c.sprite
+static inline int
+clamp_layer(lua_Integer layer) {
+	return layer < 0 ? 0 : layer > 255 ? 255 : (int)layer;
+}
+
+// c.setlayer_many(sprites, layers) sets the layer of all the sprites,
+// layers is an integer, a string of a byte per sprite, or an array of integers
+static int
+lsetlayer_many(lua_State *L) {
+	luaL_checktype(L, 1, LUA_TTABLE);
+	int n = (int)lua_rawlen(L, 1);
+	int i;
+	switch (lua_type(L, 2)) {
+	case LUA_TNUMBER: {
+		int layer = clamp_layer(luaL_checkinteger(L, 2));
+		for (i=0;i<n;i++) {
+			batch_sprite(L, i+1)->layer = layer;
+		}
+		break;
+	}
+	case LUA_TSTRING: {
+		size_t sz;
+		const uint8_t *layers = (const uint8_t *)lua_tolstring(L, 2, &sz);
+		if (sz < (size_t)n)
+			return luaL_error(L, "Need %d layers, only %d", n, (int)sz);
+		for (i=0;i<n;i++) {
+			batch_sprite(L, i+1)->layer = layers[i];
+		}
+		break;
+	}
+	default:
+		luaL_checktype(L, 2, LUA_TTABLE);
+		for (i=0;i<n;i++) {
+			struct sprite *spr = batch_sprite(L, i+1);
+			spr->layer = clamp_layer(batch_integer(L, 2, i+1));
+		}
+		break;
+	}
+	return 0;
+}
+
+static int
+lspritegc(lua_State *L) {
+	struct sprite *spr = getSpr(L);
+	if (spr->prev)
+		unlink_sprite(getCtx(L), spr);
+	if (spr->body)
+		--spr->body->ref;
+	return 0;
+}
+
+static int
+lspriteinfo(lua_State *L) {
+	struct sprite *spr = lua_touserdata(L, 1);
+	lua_pushfstring(L, "[sprite %dx%d+%d+%d %d %d]", spr->w, spr->h, spr->kx, spr->ky, spr->x, spr->y);
+
+	return 1;
+}
+
+struct sprite_attribs {
+	int transparency;
+	uint16_t background;
+	uint16_t color;
+};
+
+/*
+**    From lua 5.4 lutf8lib.c
+** Decode one UTF-8 sequence, returning NULL if byte sequence is
+** invalid.  The array 'limits' stores the minimum value for each
+** sequence length, to check for overlong representations. Its first
+** entry forces an error for non-ascii bytes with no continuation
+** bytes (count == 0).
+*/
+static const char *
+utf8_decode(const char *s, int *val) {
+  static const int limits[] =
+        {~(int)0, 0x80, 0x800, 0x10000u, 0x200000u, 0x4000000u};
+  unsigned int c = (unsigned char)s[0];
+  int res = 0;  /* final result */
+  if (c < 0x80)  /* ascii? */
+    res = c;
+  else {
+    int count = 0;  /* to count number of continuation bytes */
+    for (; c & 0x40; c <<= 1) {  /* while it needs continuation bytes... */
+      unsigned int cc = (unsigned char)s[++count];  /* read next byte */
+      if ((cc & 0xC0) != 0x80)  /* not a continuation byte? */
+        return NULL;  /* invalid byte sequence */
+      res = (res << 6) | (cc & 0x3F);  /* add lower 6 bits from cont. byte */
+    }
+    res |= ((int)(c & 0x7F) << (count * 5));  /* add first byte */
+    if (count > 5 || res < limits[count])
+      return NULL;  /* invalid byte sequence */
+    s += count;  /* skip continuation bytes read */
+  }
+  if (val) *val = res;
+  return s + 1;  /* +1 to include first byte */
+}
+
+static inline uint16_t
+color24to16(uint32_t c) {
+	int r = (c >> 16) & 0xff;
 	int g = (c >> 8) & 0xff;
 	int b = c & 0xff;
 	return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
 }
 
-static uint16_t
-get_color(lua_State *L, int idx, const char *name, uint16_t def, int *hascolor) {
-	if (lua_getfield(L, idx, name) == LUA_TNIL) {
-		if (hascolor) {
-			*hascolor = 0;
+static uint16_t
+get_color(lua_State *L, int idx, const char *name, uint16_t def, int *hascolor) {
+	if (lua_getfield(L, idx, name) == LUA_TNIL) {
+		if (hascolor) {
+			*hascolor = 0;
+		}
+		lua_pop(L, 1);
+		return def;
+	}
+	if (hascolor) {
+		*hascolor = 1;
+	}
+	int isnum;
+	uint32_t c = lua_tointegerx(L, -1, &isnum);
+	if (!isnum)
+		luaL_error(L, "Color should be uint32");
+	lua_pop(L, 1);
+	return color24to16(c);
+}
+
+static inline size_t
+body_size(int n, int h, int nspan, int sparse) {
+	size_t sz = sizeof(struct body) + sizeof(struct slot) * (n > 1 ? n - 1 : 0);
+	if (sparse)
+		sz += sizeof(uint32_t) * (h + 1) + sizeof(struct span) * nspan;
+	return sz;
+}
+
+static void
+body_init(struct body *b, int n, int h, int nspan, int sparse) {
+	b->ref = 1;
+	b->text = 0;
+	b->sparse = sparse;
+	b->n = n;
+	b->h = h;
+	b->nspan = nspan;
+	if (sparse) {
+		b->row = (uint32_t *)(b->s + (n > 1 ? n : 1));
+		b->span = (struct span *)(b->row + h + 1);
+	} else {
+		b->row = NULL;
+		b->span = NULL;
+	}
+}
+
+// Push a new body userdata
+static struct body *
+new_body(lua_State *L, int n, int h, int nspan, int sparse) {
+	struct body *b = (struct body *)lua_newuserdatauv(L, body_size(n, h, nspan, sparse), 0);
+	body_init(b, n, h, nspan, sparse);
+	return b;
+}
+
+// Replace the body of the sprite at index idx with the body on the top
+static void
+set_body(lua_State *L, int idx, struct sprite *spr) {
+	if (spr->body)
+		--spr->body->ref;
+	spr->body = (struct body *)lua_touserdata(L, -1);
+	lua_setiuservalue(L, idx, 1);
+}
+
+static struct body *
+copy_body(lua_State *L, const struct body *b) {
+	struct body *c = new_body(L, b->n, b->h, b->nspan, b->sparse);
+	memcpy(c->s, b->s, body_size(b->n, b->h, b->nspan, b->sparse) - offsetof(struct body, s));
+	c->color = b->color;
+	c->background = b->background;
+	c->text = b->text;
+	return c;
+}
+
+// Count the opaque slots and runs of a dense w * h body
+static int
+count_spans(const struct body *d, int w, int h, int *nspan) {
+	int n = 0;
+	int i,j;
+	*nspan = 0;
+	for (i=0;i<h;i++) {
+		const struct slot *s = &d->s[i * w];
+		for (j=0;j<w;j++) {
+			if (s[j].code) {
+				++n;
+				if (j == 0 || s[j-1].code == 0)
+					++*nspan;
+			}
+		}
+	}
+	return n;
+}
+
+// Fill the sparse body b with the opaque runs of the dense body d
+static void
+fill_spans(struct body *b, const struct body *d, int w) {
+	int n = 0;
+	int nspan = 0;
+	int i,j;
+	b->color = d->color;
+	b->background = d->background;
+	for (i=0;i<b->h;i++) {
+		const struct slot *s = &d->s[i * w];
+		b->row[i] = nspan;
+		for (j=0;j<w;j++) {
+			if (s[j].code == 0)
+				continue;
+			if (j == 0 || s[j-1].code == 0) {
+				struct span *sp = &b->span[nspan++];
+				sp->x = j;
+				sp->n = 0;
+				sp->slot = n;
+			}
+			b->span[nspan-1].n++;
+			b->s[n++] = s[j];
+		}
+	}
+	b->row[b->h] = nspan;
+}
+
+// Push the body of the w * h slots of d, it's sparse if the opaque runs take less than half of the dense slots
+static struct body *
+push_body(lua_State *L, const struct body *d, int w, int h) {
+	int nspan;
+	int n = count_spans(d, w, h, &nspan);
+	struct body *b;
+	if (body_size(n, h, nspan, 1) * 2 <= body_size(w * h, h, 0, 0)) {
+		b = new_body(L, n, h, nspan, 1);
+		fill_spans(b, d, w);
+	} else {
+		b = new_body(L, w * h, h, 0, 0);
+		memcpy(b->s, d->s, w * h * sizeof(struct slot));
+		b->color = d->color;
+		b->background = d->background;
+	}
+	return b;
+}
+
+// The body of the sprite to change, copy it if it's shared with the clones
+static struct body *
+writable_body(lua_State *L, int idx, struct sprite *spr) {
+	if (spr->body->ref > 1) {
+		idx = lua_absindex(L, idx);
+		copy_body(L, spr->body);
+		set_body(L, idx, spr);
+	}
+	return spr->body;
+}
+
+// Expand a sparse body to all the w * h slots (a new one, so it's writable)
+static struct body *
+dense_body(lua_State *L, int idx, struct sprite *spr) {
+	const struct body *s = spr->body;
+	if (!s->sparse)
+		return writable_body(L, idx, spr);
+	idx = lua_absindex(L, idx);
+	int n = spr->w * spr->h;
+	struct body *b = new_body(L, n, spr->h, 0, 0);
+	b->color = s->color;
+	b->background = s->background;
+	int i,j;
+	for (i=0;i<n;i++) {
+		b->s[i].code = 0;
+		b->s[i].rightpart = 0;
+		b->s[i].color = s->color;
+		b->s[i].background = s->background;
+	}
+	for (i=0;i<s->h;i++) {
+		for (j=s->row[i];j<s->row[i+1];j++) {
+			const struct span *sp = &s->span[j];
+			memcpy(&b->s[i * spr->w + sp->x], &s->s[sp->slot], sp->n * sizeof(struct slot));
+		}
+	}
+	set_body(L, idx, spr);
+	return b;
+}
+
+// The slot (x, y) of the sprite, NULL if it's transparent in a sparse body
+static struct slot *
+body_slot(struct sprite *spr, int x, int y) {
+	struct body *b = spr->body;
+	if (!b->sparse)
+		return &b->s[y * spr->w + x];
+	int i;
+	for (i=b->row[y];i<b->row[y+1];i++) {
+		struct span *sp = &b->span[i];
+		if (x < sp->x)
+			break;
+		if (x < sp->x + sp->n)
+			return &b->s[sp->slot + x - sp->x];
+	}
+	return NULL;
+}
+
+static int
+lclone(lua_State *L) {
+	struct sprite *spr = getSpr(L);
+	struct sprite *clone = (struct sprite *)lua_newuserdatauv(L, sizeof(struct sprite), 1);
+	memcpy(clone, spr, sizeof(struct sprite));
+	// share the body, until one of them changes it
+	lua_getiuservalue(L, 1, 1);
+	lua_setiuservalue(L, -2, 1);
+	++clone->body->ref;
+	clone->serial = getCtx(L)->serial++;
+	if (lua_isboolean(L, 2)) {
+		clone->prev = NULL;
+		clone->next = NULL;
+		if (lua_toboolean(L, 2)) {
+			link_sprite(getCtx(L), clone);
+		}
+	} else {
+		if (clone->prev) {
+			clone->prev = NULL;
+			clone->next = NULL;
+			link_sprite(getCtx(L), clone);
+		}
+	}
+	luaL_getmetatable(L, "RSPRITE");
+	lua_setmetatable(L, -2);
+	return 1;
+}
+
+static void
+reset_color(struct body *b, uint16_t c) {
+	int i;
+	for (i=0;i<b->n;i++) {
+		b->s[i].color = c;
+	}
+	b->color = c;
+}
+
+#define COLOR_UNINIT -2
+#define COLOR_UNDEF -1
+
+static int
+lsetcolor(lua_State *L) {
+	struct sprite *spr = getSpr(L);
+	if (lua_type(L, 2) == LUA_TNUMBER) {
+		int isnum;
+		uint32_t c = lua_tointegerx(L, -1, &isnum);
+		if (!isnum)
+			return luaL_error(L, "Color should be uint32");
+		// tint the sprite only, the body may be shared with the clones
+		spr->tint = color24to16(c);
+		return 0;
+	}
+	luaL_checktype(L, 2, LUA_TTABLE);
+	int pal[256];
+	int i,j;
+	for (i=0;i<256;i++) {
+		pal[i] = COLOR_UNINIT;
+	}
+	struct body *b = writable_body(L, 1, spr);
+	if (spr->tint >= 0) {
+		reset_color(b, spr->tint);
+		spr->tint = -1;
+	}
+	for (i=0;i<spr->h;i++) {
+		if (lua_geti(L, 2, i+1) != LUA_TSTRING) {
+			return luaL_error(L, "Invalid colormap");
+		}
+		const char * str = lua_tostring(L, -1);
+		lua_pop(L, 1);
+		for (j=0;j<spr->w;j++) {
+			int index = (uint8_t)str[j];
+			if (index > 127 || index == 0)
+				return luaL_error(L, "Invalid colormap, ascii only");
+			struct slot *s = body_slot(spr, j, i);
+			if (s == NULL)
+				continue;
+			if (pal[index] >= 0) {
+				s->color = pal[index];
+			} else if (pal[index] == COLOR_UNINIT) {
+				char key[2] = { index, 0 };
+				if (lua_getfield(L, 2, key) == LUA_TNIL) {
+					pal[index] = COLOR_UNDEF;
+				} else {
+					int isnum;
+					uint32_t c = lua_tointegerx(L, -1, &isnum);
+					if (!isnum) {
+						return luaL_error(L, "Pal .%c should be integer", index);
+					}
+					pal[index] = color24to16(c);
+					s->color = pal[index];
+				}
+				lua_pop(L, 1);
+			}
+		}
+	}
+	return 0;
+}
+
+static int
+lsetlayer(lua_State *L) {
+	struct sprite *spr = getSpr(L);
+	if (lua_type(L, 2) == LUA_TNUMBER) {
+		int isnum;
+		uint32_t c = lua_tointegerx(L, -1, &isnum);
+		if (!isnum)
+			return luaL_error(L, "Layer should be byte");
+		spr->layer = (uint8_t)c;
+		return 0;
+	}
+	return luaL_error(L, "Invalid layer");
+}
+
+
+static void
+clear_sprite_text(struct body *b) {
+	int i;
+	for (i=0;i<b->n;i++) {
+		b->s[i].code = ' ';
+		b->s[i].rightpart = 0;
+	}
+}
+
+// FNV-1a, never 0
+static uint64_t
+text_hash(const char *text, size_t sz) {
+	uint64_t h = 0xcbf29ce484222325ull;
+	size_t i;
+	for (i=0;i<sz;i++) {
+		h ^= (uint8_t)text[i];
+		h *= 0x100000001b3ull;
+	}
+	return h ? h : 1;
+}
+
+// The position of the next glyph of a text in a dense body, the text ends at y == h
+struct text_cursor {
+	struct slot *s;	// the row
+	int x;
+	int y;
+};
+
+// Put the glyph c (or the control code \n, \t) of a text at the cursor
+static void
+put_glyph(lua_State *L, struct sprite *spr, struct text_cursor *t, int c) {
+	if (c == '\n') {
+		t->x = spr->w;
+	} else if (c == '\t') {
+		t->x = (t->x / TABSIZE + 1) * TABSIZE;
+	} else if (c <= 255) {
+		t->s[t->x].code = c;
+		++t->x;
+	} else {
+		if (t->x + 1 >= spr->w) {
+			if (spr->w < 2)
+				luaL_error(L, "Invalid sprite width %d", spr->w);
+			t->x = 0;
+			++t->y;
+			if (t->y >= spr->h)
+				return;
+			t->s += spr->w;
 		}
-		lua_pop(L, 1);
-		return def;
+		t->s[t->x].code = c;
+		++t->x;
+		t->s[t->x].code = c;
+		t->s[t->x].rightpart = 1;
+		++t->x;
+	}
+	if (t->x >= spr->w) {
+		t->x = 0;
+		++t->y;
+		t->s += spr->w;
+	}
+}
+
+// The body of the sprite at index 1 to write a text into, its glyphs are cleared
+static struct body *
+text_body(lua_State *L, struct sprite *spr, struct text_cursor *t) {
+	struct body *b = dense_body(L, 1, spr);
+	b->text = 0;
+	clear_sprite_text(b);
+	t->s = b->s;
+	t->x = 0;
+	t->y = 0;
+	return b;
+}
+
+// Replace the glyphs of the sprite at index 1 with the text, it's skipped if the text is the same as the last one
+static int
+set_text(lua_State *L, struct context *ctx, struct sprite *spr, const char *text, size_t sz) {
+	uint64_t hash = text_hash(text, sz);
+	if (spr->body->text == hash)
+		return 0;
+	const char *str = text;
+	struct text_cursor t;
+	struct body *b = text_body(L, spr, &t);
+	int unicode = 0;
+	while (t.y < spr->h && ((text = utf8_decode(text, &unicode)), unicode)) {
+		if (text == NULL)
+			return luaL_error(L, "Invalid UTF-8 string %s", str);
+		put_glyph(L, spr, &t, unicode_index(ctx, unicode));
+	}
+	b->text = hash;
+	return 0;
+}
+
+static int
+lsettext(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	struct sprite * spr = getSpr(L);
+	size_t sz;
+	const char *text = luaL_checklstring(L, 2, &sz);
+	return set_text(L, ctx, spr, text, sz);
+}
+
+#define FORMAT_MAX 128
+
+static struct body *scratch_body(lua_State *L, struct context *ctx, int used, size_t n);
+
+// The text of sprite:format, the bytes are decoded into the glyphs of ctx->scratch as they are formatted
+struct format_text {
+	lua_State *L;
+	struct context *ctx;
+	uint64_t hash;	// of the bytes, the same as text_hash
+	int n;	// the glyphs in the scratch
+	int end;	// a \0 ends the text
+	int need;	// the length of the pending UTF-8 sequence
+	int pending;
+	char seq[8];
+};
+
+static void
+format_bytes(struct format_text *t, const char *s, size_t sz) {
+	size_t i;
+	for (i=0;i<sz;i++) {
+		uint8_t c = (uint8_t)s[i];
+		t->hash ^= c;
+		t->hash *= 0x100000001b3ull;
+		if (t->end)
+			continue;
+		if (t->pending == 0)
+			t->need = c < 0xc0 ? 1 : c < 0xe0 ? 2 : c < 0xf0 ? 3 : c < 0xf8 ? 4 : c < 0xfc ? 5 : 6;
+		t->seq[t->pending++] = c;
+		if (t->pending < t->need)
+			continue;
+		t->seq[t->pending] = 0;
+		t->pending = 0;
+		int unicode;
+		if (utf8_decode(t->seq, &unicode) == NULL)
+			luaL_error(t->L, "Invalid UTF-8 string in format");
+		if (unicode == 0) {
+			t->end = 1;
+		} else {
+			struct body *scratch = scratch_body(t->L, t->ctx, t->n, t->n + 1);
+			scratch->s[t->n].code = unicode_index(t->ctx, unicode);
+			++t->n;
+		}
+	}
+}
+
+static int
+format_conversion(char *buf, size_t size, const char *form, char conv, LUAI_UACINT i, double d, const char *str) {
+	switch (conv) {
+	case 'd': case 'i': case 'x': case 'X':
+		return snprintf(buf, size, form, i);
+	case 'c':
+		return snprintf(buf, size, form, (int)i);
+	case 's':
+		return snprintf(buf, size, form, str);
+	default:
+		return snprintf(buf, size, form, d);
+	}
+}
+
+// sprite:format(fmt, ...) is sprite:text(string.format(fmt, ...)) without creating the string,
+// each conversion is formatted into a stack buffer and decoded into the glyphs at once.
+// The conversions are %d %i %x %X %c %e %f %g %s %%, the width and the precision are at most 2 digits.
+static int
+lformat(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	struct sprite * spr = getSpr(L);
+	const char *fmt = luaL_checkstring(L, 2);
+	int arg = 2;
+	struct format_text t;
+	t.L = L;
+	t.ctx = ctx;
+	t.hash = 0xcbf29ce484222325ull;
+	t.n = 0;
+	t.end = 0;
+	t.need = 0;
+	t.pending = 0;
+	while (*fmt) {
+		if (*fmt != '%') {
+			const char *lit = fmt;
+			while (*fmt && *fmt != '%')
+				++fmt;
+			format_bytes(&t, lit, fmt - lit);
+			continue;
+		}
+		if (*++fmt == '%') {
+			format_bytes(&t, "%", 1);
+			++fmt;
+			continue;
+		}
+		const char *spec = fmt;
+		while (*fmt && strchr("-+ #0", *fmt))
+			++fmt;
+		int digits = 0;
+		while (*fmt >= '0' && *fmt <= '9' && ++digits <= 2)
+			++fmt;
+		if (digits <= 2 && *fmt == '.') {
+			++fmt;
+			digits = 0;
+			while (*fmt >= '0' && *fmt <= '9' && ++digits <= 2)
+				++fmt;
+		}
+		char form[32];
+		int len = fmt - spec;
+		if (digits > 2 || len > 12)
+			return luaL_error(L, "Invalid format (width or precision too long)");
+		form[0] = '%';
+		memcpy(form + 1, spec, len++);
+		LUAI_UACINT i = 0;
+		double d = 0;
+		const char *str = NULL;
+		++arg;
+		switch (*fmt) {
+		case 'd': case 'i': case 'x': case 'X':
+			memcpy(form + len, LUA_INTEGER_FRMLEN, sizeof(LUA_INTEGER_FRMLEN) - 1);
+			len += sizeof(LUA_INTEGER_FRMLEN) - 1;
+			i = (LUAI_UACINT)luaL_checkinteger(L, arg);
+			break;
+		case 'c':
+			i = (int)luaL_checkinteger(L, arg);
+			luaL_argcheck(L, i != 0, arg, "%c of 0 ends the text");
+			break;
+		case 'e': case 'f': case 'g':
+			d = (double)luaL_checknumber(L, arg);
+			break;
+		case 's': {
+			size_t sz;
+			str = luaL_checklstring(L, arg, &sz);
+			if (len == 1) {
+				format_bytes(&t, str, sz);
+				++fmt;
+				continue;
+			}
+			break;
+		}
+		default:
+			return luaL_error(L, "Invalid conversion '%%%c' in format", *fmt ? *fmt : ' ');
+		}
+		form[len++] = *fmt;
+		form[len] = 0;
+		char buf[FORMAT_MAX];
+		int n = format_conversion(buf, FORMAT_MAX, form, *fmt, i, d, str);
+		if (n >= FORMAT_MAX) {
+			// A long string or a huge %f, format it again into a temporary buffer of the exact size
+			char *tmp = (char *)lua_newuserdatauv(L, n + 1, 0);
+			format_conversion(tmp, n + 1, form, *fmt, i, d, str);
+			format_bytes(&t, tmp, n);
+			lua_pop(L, 1);
+		} else if (n > 0) {
+			format_bytes(&t, buf, n);
+		}
+		++fmt;
+	}
+	if (t.pending)
+		return luaL_error(L, "Invalid UTF-8 string in format");
+	uint64_t hash = t.hash ? t.hash : 1;
+	if (spr->body->text == hash)
+		return 0;
+	struct text_cursor c;
+	struct body *b = text_body(L, spr, &c);
+	int k;
+	for (k=0;k<t.n && c.y < spr->h;k++) {
+		put_glyph(L, spr, &c, ctx->scratch->s[k].code);
+	}
+	b->text = hash;
+	return 0;
+}
+
+// Grow the scratch slots of the sprite parser to n, keep the first used ones
+static struct body *
+scratch_body(lua_State *L, struct context *ctx, int used, size_t n) {
+	if (n > (size_t)ctx->scratch_cap) {
+		if (n > 0x10000000)
+			luaL_error(L, "sprite too large");
+		int cap = ctx->scratch_cap * 2;
+		if (cap < (int)n)
+			cap = (int)n;
+		if (cap < 1024)
+			cap = 1024;
+		struct body *b = new_body(L, cap, 0, 0, 0);
+		if (used > 0)
+			memcpy(b->s, ctx->scratch->s, used * sizeof(struct slot));
+		ctx->scratch = b;
+		ctx->scratch_cap = cap;
+		lua_setiuservalue(L, lua_upvalueindex(1), 7);
+	}
+	return ctx->scratch;
+}
+
+static inline void
+end_line(lua_State *L, int n, int *row, int *width, int *height) {
+	if (*width < 0)
+		*width = n - *row;
+	else if (n - *row != *width)
+		luaL_error(L, "sprite is not a rect (line %d)", *height + 1);
+	++*height;
+	*row = n;
+}
+
+// Decode the lines of the sprite at idx into ctx->scratch in one pass, returns the width and the height.
+// Each string of the array may have several lines separated by '\n'.
+static void
+parse_sprite(lua_State *L, struct context *ctx, int idx, struct sprite_attribs *a, int *w, int *h) {
+	int lines = (int)lua_rawlen(L, idx);
+	int n = 0;
+	int width = -1;
+	int height = 0;
+	int i;
+	for (i=1;i<=lines;i++) {
+		if (lua_rawgeti(L, idx, i) != LUA_TSTRING)
+			luaL_error(L, "Invalid sprite line %d", i);
+		size_t sz;
+		const char *str = lua_tolstring(L, -1, &sz);
+		const char *end = str + sz;
+		lua_pop(L, 1);	// still referenced by the table
+		// a glyph takes at least one byte, and a wide one takes at least two
+		struct slot *s = scratch_body(L, ctx, n, n + sz)->s;
+		int row = n;
+		while (str < end) {
+			if (*str == '\n') {
+				end_line(L, n, &row, &width, &height);
+				++str;
+				continue;
+			}
+			int unicode;
+			if (!(str = utf8_decode(str, &unicode)))
+				luaL_error(L, "Invalid utf8 text");
+			int c = unicode == a->transparency ? 0 : unicode_index(ctx, unicode);
+			s[n].code = c;
+			s[n].rightpart = 0;
+			s[n].color = a->color;
+			s[n].background = a->background;
+			++n;
+			if (c > 255) {
+				s[n] = s[n-1];
+				s[n].rightpart = 1;
+				++n;
+			}
+		}
+		if (sz == 0 || end[-1] != '\n')
+			end_line(L, n, &row, &width, &height);
+	}
+	if (height == 0)
+		luaL_error(L, "sprite height 0");
+	if (width <= 0 || width > 0xffff)
+		luaL_error(L, "Invalid sprite width %d", width);
+	*w = width;
+	*h = height;
+}
+
+static int
+lsprite(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	luaL_checktype(L, 1, LUA_TTABLE);
+	struct sprite_attribs a;
+	a.transparency = 0;
+	if (lua_getfield(L, 1, "transparency") == LUA_TSTRING) {
+		const char * t = lua_tostring(L, -1);
+		a.transparency = (unsigned)*t;
+		if (a.transparency > 127 || a.transparency == 0) {
+			return luaL_error(L, "transparency is ascii only");
+		}
+	}
+	lua_pop(L, 1);
+	int background;
+	a.color = get_color(L, 1, "color", 0xffff, NULL);
+	a.background = get_color(L, 1, "background", 0, &background);
+	int w,h;
+	parse_sprite(L, ctx, 1, &a, &w, &h);
+	struct sprite *spr = (struct sprite *)lua_newuserdatauv(L, sizeof(struct sprite), 1);
+	spr->body = NULL;
+	spr->tint = -1;
+	struct body *scratch = ctx->scratch;
+	scratch->color = a.color;
+	scratch->background = a.background;
+	push_body(L, scratch, w, h);
+	set_body(L, -2, spr);
+	spr->w = w;
+	spr->h = h;
+	spr->x = 0;
+	spr->y = 0;
+	spr->kx =0;
+	spr->ky =0;
+	spr->prev = NULL;
+	spr->next = NULL;
+	spr->serial = ctx->serial++;
+	spr->background = background;
+	spr->layer = 1;
+	if (lua_getfield(L, 1, "layer") == LUA_TNUMBER) {
+		spr->layer = clamp_layer(lua_tointeger(L, -1));
+	}
+	lua_pop(L, 1);
+	if (lua_getfield(L, 1, "kx") == LUA_TNUMBER) {
+		spr->kx = lua_tointeger(L, -1);
+	}
+	lua_pop(L, 1);
+	if (lua_getfield(L, 1, "ky") == LUA_TNUMBER) {
+		spr->ky = lua_tointeger(L, -1);
+	}
+	lua_pop(L, 1);
+
+	if (luaL_newmetatable(L, "RSPRITE")) {
+		luaL_Reg l[] = {
+			{ "setpos", NULL },
+			{ "setcolor", lsetcolor },
+			{ "setlayer", lsetlayer },
+			{ "clone", NULL },
+			{ "visible", NULL },
+			{ "__tostring", lspriteinfo },
+			{ "__gc", NULL },
+			{ "__index", NULL },
+			{ NULL, NULL },
+		};
+		luaL_setfuncs(L, l, 0);
+		lua_pushvalue(L, -1);
+		lua_setfield(L, -2, "__index");
+
+		luaL_Reg l2[] = {
+			{ "setpos", lsetpos },
+			{ "clone", lclone },
+			{ "visible", lvisible },
+			{ "text", lsettext },
+			{ "format", lformat },
+			{ "__gc", lspritegc },
+			{ NULL, NULL },
+		};
+
+		lua_pushvalue(L, lua_upvalueindex(1));
+		luaL_setfuncs(L, l2, 1);
+	}
+	lua_setmetatable(L, -2);
+	link_sprite(ctx, spr);
+	return 1;
+}
+
+static struct sprite *
+getTilemap(lua_State *L) {
+	return (struct sprite *)luaL_checkudata(L, 1, "RTILEMAP");
+}
+
+static void
+tilemap_cell(lua_State *L, struct sprite *m, int *x, int *y) {
+	*x = luaL_checkinteger(L, 2);
+	*y = luaL_checkinteger(L, 3);
+	if (*x < 0 || *x >= (int)m->w || *y < 0 || *y >= (int)m->h)
+		luaL_error(L, "Out of tilemap (%d, %d)", *x, *y);
+}
+
+static uint32_t
+color16to24rgb(uint16_t c16) {
+	uint8_t c[3];
+	color16to24(c16, c);
+	return c[2] << 16 | c[1] << 8 | c[0];
+}
+
+// tilemap:set(x, y, char, color, background), char is an utf8 string or a glyph index, nil clears the cell
+static int
+ltilemap_set(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	struct sprite *m = getTilemap(L);
+	int x, y;
+	tilemap_cell(L, m, &x, &y);
+	int c = 0;
+	switch (lua_type(L, 4)) {
+	case LUA_TSTRING: {
+		int unicode;
+		if (utf8_decode(lua_tostring(L, 4), &unicode) == NULL)
+			return luaL_error(L, "Invalid utf8 text");
+		c = unicode_index(ctx, unicode);
+		break;
+	}
+	case LUA_TNUMBER:
+		c = luaL_checkinteger(L, 4);
+		if (c < 0 || c > 0x7fffff)
+			return luaL_error(L, "Invalid glyph %d", c);
+		break;
+	case LUA_TNIL:
+	case LUA_TNONE:
+		break;
+	default:
+		return luaL_error(L, "Invalid glyph %s", luaL_typename(L, 4));
+	}
+	int n = c > 255 ? 2 : 1;
+	if (x + n > (int)m->w)
+		return luaL_error(L, "No room for the right part at (%d, %d)", x, y);
+	uint16_t color = color24to16(luaL_optinteger(L, 5, 0xffffff));
+	uint16_t background = color24to16(luaL_optinteger(L, 6, 0));
+	struct slot *s = &m->body->s[y * m->w + x];
+	// Clear the other half of the wide glyphs overwritten
+	if (s[0].rightpart)
+		memset(&s[-1], 0, sizeof(struct slot));
+	if (x + n < (int)m->w && s[n].rightpart)
+		memset(&s[n], 0, sizeof(struct slot));
+	s->code = c;
+	s->rightpart = 0;
+	s->color = color;
+	s->background = background;
+	if (n == 2) {
+		s[1] = s[0];
+		s[1].rightpart = 1;
+	}
+	return 0;
+}
+
+// tilemap:get(x, y) returns glyph index, color, background
+static int
+ltilemap_get(lua_State *L) {
+	struct sprite *m = getTilemap(L);
+	int x, y;
+	tilemap_cell(L, m, &x, &y);
+	struct slot *s = &m->body->s[y * m->w + x];
+	lua_pushinteger(L, s->code);
+	lua_pushinteger(L, color16to24rgb(s->color));
+	lua_pushinteger(L, color16to24rgb(s->background));
+	return 3;
+}
+
+static int
+ltilemap_setpos(lua_State *L) {
+	struct sprite *m = getTilemap(L);
+	m->x = luaL_checkinteger(L, 2);
+	m->y = luaL_checkinteger(L, 3);
+	return 0;
+}
+
+// Link the tilemap back in the order of creation, so hiding and showing it doesn't change what it covers
+static void
+tilemap_link(struct context *ctx, struct sprite *m) {
+	struct sprite *head = ctx->tilemap;
+	if (head == NULL) {
+		list_link(&ctx->tilemap, m);
+		return;
+	}
+	struct sprite *node = head;
+	do {
+		if (node->serial > m->serial)
+			break;
+		node = node->next;
+	} while (node != head);
+	// insert before node, or at the end if node is the head again
+	list_link(&node, m);
+	if (node == head && head->serial > m->serial)
+		ctx->tilemap = m;
+}
+
+static int
+ltilemap_visible(lua_State *L) {
+	struct sprite *m = (struct sprite *)lua_touserdata(L, 1);
+	struct context *ctx = getCtx(L);
+	if (lua_toboolean(L, 2)) {
+		if (m->prev == NULL)
+			tilemap_link(ctx, m);
+	} else if (m->prev) {
+		list_unlink(&ctx->tilemap, m);
+	}
+	return 0;
+}
+
+static int
+ltilemap_gc(lua_State *L) {
+	struct sprite *m = (struct sprite *)lua_touserdata(L, 1);
+	if (m->prev)
+		list_unlink(&getCtx(L)->tilemap, m);
+	return 0;
+}
+
+static int
+ltilemapinfo(lua_State *L) {
+	struct sprite *m = lua_touserdata(L, 1);
+	lua_pushfstring(L, "[tilemap %dx%d %d %d]", m->w, m->h, m->x, m->y);
+	return 1;
+}
+
+static void
+mapfile_link(struct context *ctx, struct mapfile *m) {
+	struct mapfile *node = ctx->mapfile;
+	if (node == NULL) {
+		m->prev = m->next = m;
+		ctx->mapfile = m;
+	} else {
+		m->next = node;
+		m->prev = node->prev;
+		node->prev = m;
+		m->prev->next = m;
+	}
+}
+
+static void
+mapfile_unlink(struct context *ctx, struct mapfile *m) {
+	if (ctx->mapfile == m)
+		ctx->mapfile = m->next == m ? NULL : m->next;
+	m->prev->next = m->next;
+	m->next->prev = m->prev;
+	m->prev = NULL;
+	m->next = NULL;
+}
+
+static void
+filemap_close(struct filemap *f) {
+	if (f->data == NULL)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(f->data);
+	CloseHandle(f->mapping);
+	CloseHandle(f->file);
+#else
+	munmap((void *)f->data, f->size);
+#endif
+	f->data = NULL;
+}
+
+// Map the file into memory, returns the error or NULL
+static const char *
+filemap_open(struct filemap *f, const char *filename, size_t minsize) {
+#ifdef _WIN32
+	f->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (f->file == INVALID_HANDLE_VALUE)
+		return "Can't open";
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(f->file, &size) || size.QuadPart < (LONGLONG)minsize) {
+		CloseHandle(f->file);
+		return "Invalid size";
+	}
+	f->mapping = CreateFileMappingA(f->file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (f->mapping == NULL) {
+		CloseHandle(f->file);
+		return "Can't map";
 	}
-	if (hascolor) {
-		*hascolor = 1;
+	f->data = (const uint8_t *)MapViewOfFile(f->mapping, FILE_MAP_READ, 0, 0, 0);
+	if (f->data == NULL) {
+		CloseHandle(f->mapping);
+		CloseHandle(f->file);
+		return "Can't map";
 	}
-	int isnum;
-	uint32_t c = lua_tointegerx(L, -1, &isnum);
-	if (!isnum)
-		luaL_error(L, "Color should be uint32");
-	lua_pop(L, 1);
-	return color24to16(c);
+	f->size = (size_t)size.QuadPart;
+#else
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return "Can't open";
+	off_t size = lseek(fd, 0, SEEK_END);
+	if (size < (off_t)minsize) {
+		close(fd);
+		return "Invalid size";
+	}
+	void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return "Can't map";
+	f->data = (const uint8_t *)data;
+	f->size = size;
+#endif
+	return NULL;
 }
 
-static inline size_t
-sprite_size(int w, int h) {
-	return sizeof(struct sprite) + sizeof(struct slot) * (w * h -1);
+struct psf2_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t headersize;
+	uint32_t flags;	// PSF2_UNICODE
+	uint32_t length;	// the number of glyphs
+	uint32_t charsize;	// bytes per glyph
+	uint32_t height;
+	uint32_t width;
+};
+
+#define PSF2_MAGIC 0x864ab572
+#define PSF2_UNICODE 1
+#define PSF2_SEPARATOR 0xff
+#define PSF2_STARTSEQ 0xfe
+
+// Map a PSF2 font file, the glyphs are paged in when they are drawn. Returns the error or NULL
+static const char *
+load_psf2(struct filemap *f, const char *filename, int maxwidth, int height, const uint8_t **glyph, int *n, int *size, int *pitch) {
+	const char *err = filemap_open(f, filename, sizeof(struct psf2_header));
+	if (err)
+		return err;
+	const struct psf2_header *h = (const struct psf2_header *)f->data;
+	if (h->magic != PSF2_MAGIC || h->headersize < sizeof(*h) || h->headersize > f->size)
+		return "Invalid PSF2";
+	if (h->height != (uint32_t)height || h->width == 0 || h->width > (uint32_t)maxwidth)
+		return "Unsupported glyph size of";
+	*pitch = (h->width + 7) / 8;
+	if (h->charsize != *pitch * h->height || h->length > 0x7fffff || (f->size - h->headersize) / h->charsize < h->length)
+		return "Invalid PSF2";
+	*glyph = f->data + h->headersize;
+	*n = h->length;
+	*size = h->charsize;
+	return NULL;
 }
 
-static int
-lclone(lua_State *L) {
-	struct sprite *spr = getSpr(L);
-	size_t sz = sprite_size(spr->w,spr->h);
-	struct sprite *clone = (struct sprite *)lua_newuserdatauv(L, sz, 0);
-	memcpy(clone, spr, sz);
-	if (lua_isboolean(L, 2)) {
-		clone->prev = NULL;
-		clone->next = NULL;
-		if (lua_toboolean(L, 2)) {
-			link_sprite(getCtx(L), clone);
+// Map the unicodes of the PSF2 font to base + glyph index, for the glyphs less than maxn.
+// The narrow glyph 0 is skipped, code 0 is the empty slot.
+static void
+psf2_unicode(const struct filemap *f, uint16_t *map, int base, int maxn) {
+	const struct psf2_header *h = (const struct psf2_header *)f->data;
+	int n = h->length < (uint32_t)maxn ? (int)h->length : maxn;
+	int i;
+	if (!(h->flags & PSF2_UNICODE)) {
+		for (i=0;i<n && i<0x10000;i++) {
+			if (base + i != 0)
+				map[i] = base + i;
 		}
-	} else {
-		if (clone->prev) {
-			clone->prev = NULL;
-			clone->next = NULL;
-			link_sprite(getCtx(L), clone);
+		return;
+	}
+	const char *p = (const char *)f->data + h->headersize + (size_t)h->length * h->charsize;
+	const char *end = (const char *)f->data + f->size;
+	for (i=0;i<n && p<end;i++) {
+		// utf8 codes, then sequences (ignored) after PSF2_STARTSEQ, until PSF2_SEPARATOR
+		int seq = 0;
+		while (p < end && (uint8_t)*p != PSF2_SEPARATOR) {
+			if ((uint8_t)*p == PSF2_STARTSEQ) {
+				seq = 1;
+				++p;
+				continue;
+			}
+			// the length of the utf8 sequence by the leading byte, the table may be truncated
+			uint8_t c = *p;
+			int len = c < 0xc0 ? 1 : c < 0xe0 ? 2 : c < 0xf0 ? 3 : c < 0xf8 ? 4 : c < 0xfc ? 5 : 6;
+			if (end - p < len)
+				return;
+			int unicode;
+			const char *next = utf8_decode(p, &unicode);
+			if (next == NULL)
+				return;
+			if (!seq && unicode < 0x10000 && base + i != 0)
+				map[unicode] = base + i;
+			p = next;
 		}
+		++p;
 	}
-	luaL_getmetatable(L, "RSPRITE");
-	lua_setmetatable(L, -2);
-	return 1;
 }
 
+// Scale the built-in glyphs (6x12) by an integer, and center them in the cell. slots is 2 for the wide glyphs
 static void
-reset_color(struct sprite *spr, uint16_t c) {
-	int i,j;
-	struct slot *s = spr->s;
-	for (i=0;i<spr->h;i++) {
-		for (j=0;j<spr->w;j++) {
-			s[j].color = c;
+fit_glyphs(uint8_t *dst, int code, int n, int slots, int cw, int ch, int scale) {
+	int w = cw * slots;
+	int pitch = (w + 7) / 8;
+	int ox = (w - 6 * slots * scale) / 2;
+	int oy = (ch - 12 * scale) / 2;
+	uint32_t dot = 0xffffffffu << (32 - scale);
+	struct slot s;
+	memset(&s, 0, sizeof(s));
+	int i,x,y,k;
+	for (i=0;i<n;i++) {
+		s.code = code + i;
+		for (y=0;y<12;y++) {
+			uint32_t src = 0;
+			for (k=0;k<slots;k++) {
+				int g_pitch, shift;
+				s.rightpart = k;
+				const uint8_t *g = glyph_graph(&builtin_font, &s, &g_pitch, &shift);
+				src |= ((glyph_row(g + y * g_pitch, g_pitch) << shift) & 0xfc000000) >> (6 * k);
+			}
+			uint32_t row = 0;
+			for (x=0;x<6*slots;x++) {
+				if (src & (0x80000000 >> x))
+					row |= dot >> (ox + x * scale);
+			}
+			for (k=0;k<scale;k++) {
+				uint8_t *d = dst + (oy + y * scale + k) * pitch;
+				for (x=0;x<pitch;x++) {
+					d[x] = row >> (24 - x * 8);
+				}
+			}
 		}
-		s += spr->w;
+		dst += pitch * ch;
 	}
 }
 
-#define COLOR_UNINIT -2
-#define COLOR_UNDEF -1
+// The glyphs of the built-in font for the cell sizes other than 6x12, except the ones replaced by the font files
+static void
+fit_builtin(lua_State *L, struct context *ctx, const char *filename[2]) {
+	struct font *f = &ctx->font;
+	int cw = ctx->raster.cell_w;
+	int ch = ctx->raster.cell_h;
+	int scale = cw / 6 < ch / 12 ? cw / 6 : ch / 12;
+	if (scale == 0)
+		luaL_error(L, "The built-in font doesn't fit the cell %dx%d, set font and widefont", cw, ch);
+	int narrow_pitch = (cw + 7) / 8;
+	int wide_pitch = (cw * 2 + 7) / 8;
+	size_t narrow_size = filename[0] ? 0 : (size_t)builtin_font.narrow_n * narrow_pitch * ch;
+	size_t wide_size = filename[1] ? 0 : (size_t)builtin_font.wide_n * wide_pitch * ch;
+	uint8_t *g = (uint8_t *)lua_newuserdatauv(L, narrow_size + wide_size, 0);
+	memset(g, 0, narrow_size + wide_size);
+	if (filename[0] == NULL) {
+		fit_glyphs(g, 0, builtin_font.narrow_n, 1, cw, ch, scale);
+		f->narrow = g;
+		f->narrow_pitch = narrow_pitch;
+		f->narrow_size = narrow_pitch * ch;
+	}
+	if (filename[1] == NULL) {
+		fit_glyphs(g + narrow_size, 256, builtin_font.wide_n, 2, cw, ch, scale);
+		f->wide = g + narrow_size;
+		f->wide_pitch = wide_pitch;
+		f->wide_size = wide_pitch * ch;
+		f->wide_shift = cw;
+	}
+	lua_setiuservalue(L, lua_upvalueindex(1), 9);
+}
 
-static int
-lsetcolor(lua_State *L) {
-	struct sprite *spr = getSpr(L);
-	if (lua_type(L, 2) == LUA_TNUMBER) {
-		int isnum;
-		uint32_t c = lua_tointegerx(L, -1, &isnum);
-		if (!isnum)
-			return luaL_error(L, "Color should be uint32");
-		uint16_t c16 = color24to16(c);
-		reset_color(spr, c16);
-		return 0;
+// Unmap the font files loaded before raising the error
+static void
+font_error(lua_State *L, struct context *ctx, const char *err, const char *filename) {
+	filemap_close(&ctx->font.file[0]);
+	filemap_close(&ctx->font.file[1]);
+	ctx->font = builtin_font;
+	ctx->raster.font = &builtin_font;
+	luaL_error(L, "%s font %s", err, filename);
+}
+
+// c.init { font = "narrow.psf", widefont = "wide.psf" } replaces the built-in fonts by PSF2 files,
+// their unicode tables replace the built-in one. The glyph index is a byte in a narrow slot, so only the first 256 glyphs of the narrow font are used.
+static void
+init_font(lua_State *L, struct context *ctx) {
+	static const char * name[2] = { "font", "widefont" };
+	struct font *f = &ctx->font;
+	const char *filename[2];
+	int i;
+	*f = builtin_font;
+	for (i=0;i<2;i++) {
+		filename[i] = NULL;
+		if (lua_getfield(L, 1, name[i]) == LUA_TSTRING)
+			filename[i] = lua_tostring(L, -1);
+		lua_pop(L, 1);
 	}
-	luaL_checktype(L, 2, LUA_TTABLE);
-	int pal[256];
-	int i,j;
-	for (i=0;i<256;i++) {
-		pal[i] = COLOR_UNINIT;
+	int cw = ctx->raster.cell_w;
+	int ch = ctx->raster.cell_h;
+	if (cw != 6 || ch != 12) {
+		if (filename[0] == NULL || filename[1] == NULL)
+			fit_builtin(L, ctx, filename);
+		ctx->raster.font = f;
 	}
-	struct slot *s = spr->s;
-	for (i=0;i<spr->h;i++) {
-		if (lua_geti(L, 2, i+1) != LUA_TSTRING) {
-			return luaL_error(L, "Invalid colormap");
+	if (filename[0] == NULL && filename[1] == NULL)
+		return;
+	const char *err;
+	if (filename[0] && (err = load_psf2(&f->file[0], filename[0], cw, ch, &f->narrow, &f->narrow_n, &f->narrow_size, &f->narrow_pitch)))
+		font_error(L, ctx, err, filename[0]);
+	if (filename[1]) {
+		if ((err = load_psf2(&f->file[1], filename[1], cw * 2, ch, &f->wide, &f->wide_n, &f->wide_size, &f->wide_pitch)))
+			font_error(L, ctx, err, filename[1]);
+		f->wide_shift = cw;
+	}
+	// The glyph index is a byte in a narrow slot, and the unicode map is uint16_t (255 for none)
+	if (f->narrow_n > 256)
+		f->narrow_n = 256;
+	if (f->wide_n > 0x10000 - 256)
+		f->wide_n = 0x10000 - 256;
+	// Merge the unicode maps into a temporary flat one, the wide glyphs first, the narrow ones (of the file or built-in) cover them
+	uint16_t *map = (uint16_t *)lua_newuserdatauv(L, 0x10000 * sizeof(uint16_t), 0);
+	int u;
+	for (u=0;u<0x10000;u++) {
+		int c = builtin_font.block[builtin_font.page[u >> 8]][u & 0xff];
+		map[u] = c > 255 && filename[1] == NULL ? c : 255;
+	}
+	if (filename[1])
+		psf2_unicode(&f->file[1], map, 256, f->wide_n);
+	if (filename[0]) {
+		psf2_unicode(&f->file[0], map, 0, 256);
+	} else {
+		for (u=0;u<0x10000;u++) {
+			int c = builtin_font.block[builtin_font.page[u >> 8]][u & 0xff];
+			if (c < 255)
+				map[u] = c;
 		}
-		const char * str = lua_tostring(L, -1);
-		lua_pop(L, 1);
-		for (j=0;j<spr->w;j++) {
-			int index = (uint8_t)str[j];
-			if (index > 127 || index == 0)
-				return luaL_error(L, "Invalid colormap, ascii only");
-			if (pal[index] >= 0) {
-				s[j].color = pal[index];
-			} else if (pal[index] == COLOR_UNINIT) {
-				char key[2] = { index, 0 };
-				if (lua_getfield(L, 2, key) == LUA_TNIL) {
-					pal[index] = COLOR_UNDEF;
-				} else {
-					int isnum;
-					uint32_t c = lua_tointegerx(L, -1, &isnum);
-					if (!isnum) {
-						return luaL_error(L, "Pal .%c should be integer", index);
-					}
-					pal[index] = color24to16(c);
-					s[j].color = pal[index];
-				}
-				lua_pop(L, 1);
+	}
+	for (u=0;u<32;u++) {
+		map[u] = u;	// the control codes (\n, \t) are not glyphs
+	}
+	// Compress it into the two level table, the block 0 is the empty one
+	uint8_t page[256];
+	int nblock = 1;
+	for (i=0;i<256;i++) {
+		page[i] = 0;
+		for (u=0;u<256;u++) {
+			if (map[i * 256 + u] != 255) {
+				page[i] = nblock++;
+				break;
 			}
 		}
-		s += spr->w;
 	}
-	return 0;
+	uint8_t *t = (uint8_t *)lua_newuserdatauv(L, 256 + nblock * 256 * sizeof(uint16_t), 0);
+	uint16_t (*block)[256] = (uint16_t (*)[256])(t + 256);
+	memcpy(t, page, 256);
+	for (u=0;u<256;u++) {
+		block[0][u] = 255;
+	}
+	for (i=0;i<256;i++) {
+		if (page[i])
+			memcpy(block[page[i]], &map[i * 256], 256 * sizeof(uint16_t));
+	}
+	f->page = t;
+	f->block = (const uint16_t (*)[256])block;
+	lua_setiuservalue(L, lua_upvalueindex(1), 8);
+	lua_pop(L, 1);
+	ctx->raster.font = f;
 }
 
 static void
-reset_layer(struct sprite *spr, uint8_t c) {
-	int i,j;
-	struct slot *s = spr->s;
-	for (i=0;i<spr->h;i++) {
-		for (j=0;j<spr->w;j++) {
-			s[j].layer = c;
-		}
-		s += spr->w;
-	}
+mapfile_close(struct mapfile *m) {
+	filemap_close(&m->map);
 }
 
-static int
-lsetlayer(lua_State *L) {
-	struct sprite *spr = getSpr(L);
-	if (lua_type(L, 2) == LUA_TNUMBER) {
-		int isnum;
-		uint32_t c = lua_tointegerx(L, -1, &isnum);
-		if (!isnum)
-			return luaL_error(L, "Layer should be byte");
-		reset_layer(spr, c);
-		return 0;
-	}
-	return luaL_error(L, "Invalid layer");
+// Map the whole file, the pages are read on demand, so it doesn't depend on the size of the map
+static const char *
+mapfile_open(struct mapfile *m, const char *filename) {
+	const char *err = filemap_open(&m->map, filename, sizeof(struct mapfile_header));
+	if (err)
+		return err;
+	const struct mapfile_header *h = (const struct mapfile_header *)m->map.data;
+	if (memcmp(h->magic, "RMAP", 4) != 0 || h->version != 1)
+		return "Invalid format";
+	if (h->width == 0 || h->height == 0 || h->width > 0x7fffffff || h->height > 0x7fffffff || h->chunk_w == 0 || h->chunk_h == 0)
+		return "Invalid size";
+	m->width = h->width;
+	m->height = h->height;
+	m->chunk_w = h->chunk_w;
+	m->chunk_h = h->chunk_h;
+	m->chunks_x = (m->width + m->chunk_w - 1) / m->chunk_w;
+	m->chunks_y = (m->height + m->chunk_h - 1) / m->chunk_h;
+	m->chunk_bytes = (size_t)m->chunk_w * m->chunk_h * sizeof(struct slot);
+	if ((m->map.size - sizeof(*h)) / sizeof(uint64_t) < (uint64_t)m->chunks_x * m->chunks_y)
+		return "Invalid index";
+	m->index = (const uint64_t *)(h + 1);
+	return NULL;
 }
 
+static struct mapfile *
+getMapfile(lua_State *L) {
+	return (struct mapfile *)luaL_checkudata(L, 1, "RMAPFILE");
+}
 
-static void
-clear_sprite_text(struct sprite *spr) {
-	int n = spr->w * spr->h;
-	int i;
-	for (i=0;i<n;i++) {
-		spr->s[i].code = ' ';
-		spr->s[i].rightpart = 0;
+// mapfile:get(x, y) returns glyph index, color, background
+static int
+lmapfile_get(lua_State *L) {
+	struct mapfile *m = getMapfile(L);
+	int x = luaL_checkinteger(L, 2);
+	int y = luaL_checkinteger(L, 3);
+	if (x < 0 || x >= m->width || y < 0 || y >= m->height)
+		return luaL_error(L, "Out of map (%d, %d)", x, y);
+	const struct slot *s = mapfile_chunk(m, x / m->chunk_w, y / m->chunk_h);
+	if (s == NULL) {
+		lua_pushinteger(L, 0);
+		lua_pushinteger(L, 0);
+		lua_pushinteger(L, 0);
+	} else {
+		s += (y % m->chunk_h) * m->chunk_w + x % m->chunk_w;
+		lua_pushinteger(L, s->code);
+		lua_pushinteger(L, color16to24rgb(s->color));
+		lua_pushinteger(L, color16to24rgb(s->background));
 	}
+	return 3;
 }
 
 static int
-lsettext(lua_State *L) {
+lmapfile_setpos(lua_State *L) {
+	struct mapfile *m = getMapfile(L);
+	m->x = luaL_checkinteger(L, 2);
+	m->y = luaL_checkinteger(L, 3);
+	return 0;
+}
+
+static int
+lmapfile_visible(lua_State *L) {
+	struct mapfile *m = getMapfile(L);
 	struct context *ctx = getCtx(L);
-	struct sprite * spr = getSpr(L);
-	const char *text = luaL_checkstring(L, 2);
-	int x=0;
-	int y=0;
-	struct slot *s = spr->s;
-	int unicode = 0;
-	clear_sprite_text(spr);
-	while (y < spr->h && ((text = utf8_decode(text, &unicode)), unicode)) {
-		if (text == NULL)
-			return luaL_error(L, "Invalid UTF-8 string %s", lua_tostring(L, 2));
-		int c = unicode_index(ctx, unicode);
-		if (c == '\n') {
-			x = spr->w;
-		} else if (c == '\t') {
-			x = (x / TABSIZE + 1) * TABSIZE;
-		} else if (c <= 255) {
-			s[x].code = c;
-			++x;
-		} else {
-			if (x + 1 >= spr->w) {
-				if (spr->w < 2)
-					return luaL_error(L, "Invalid sprite width %d", spr->w);
-				x = 0;
-				++y;
-				if (y <= spr->h)
-					break;
-				s += spr->w;
-			}
-			s[x].code = c;
-			++x;
-			s[x].code = c;
-			s[x].rightpart = 1;
-			++x;
-		}
-		if (x >= spr->w) {
-			x = 0;
-			++y;
-			s += spr->w;
-		}
+	if (lua_toboolean(L, 2)) {
+		if (m->prev == NULL && m->map.data)
+			mapfile_link(ctx, m);
+	} else if (m->prev) {
+		mapfile_unlink(ctx, m);
 	}
 	return 0;
 }
 
 static int
-get_sprite_width(lua_State *L, struct context *ctx, int idx, int line) {
-	if (lua_geti(L, idx, line) != LUA_TSTRING) {
-		luaL_error(L, "Invalid sprite");
-	}
-	const char * s = lua_tostring(L, -1);
-	int len = 0;
-	int code = 0;
-	while ((s = utf8_decode(s, &code)) && code) {
-		int c = unicode_index(ctx, code);
-		if (c > 255)
-			len += 2;
-		else
-			++len;
-	}
-	lua_pop(L, 1);
-	return len;
+lmapfile_gc(lua_State *L) {
+	struct mapfile *m = (struct mapfile *)lua_touserdata(L, 1);
+	if (m->prev)
+		mapfile_unlink(getCtx(L), m);
+	mapfile_close(m);
+	return 0;
 }
 
-static void
-check_sprite_size(lua_State *L, struct context *ctx, int idx, int *w, int *h) {
-	int lines = (int)lua_rawlen(L, idx);
-	if (lines <= 0)
-		luaL_error(L, "sprite height 0");
-	*h = lines;
-	int width = get_sprite_width(L, ctx, idx, 1);
-	if (width <= 0)
-		luaL_error(L, "sprite width 0");
-	*w = width;
-	int i;
-	for (i=2;i<=lines;i++) {
-		if (get_sprite_width(L, ctx, idx, i) != width) {
-			luaL_error(L, "sprite is not a rect");
-		}
-	}
+static int
+lmapfileinfo(lua_State *L) {
+	struct mapfile *m = lua_touserdata(L, 1);
+	lua_pushfstring(L, "[mapfile %dx%d %d %d]", m->width, m->height, m->x, m->y);
+	return 1;
 }
 
+// c.mapfile(filename [, prefetch]) opens a map file saved by tilemap:save, it's drawn under the tilemaps
 static int
-lsprite(lua_State *L) {
+lmapfile(lua_State *L) {
 	struct context *ctx = getCtx(L);
-	luaL_checktype(L, 1, LUA_TTABLE);
-	int w,h;
-	check_sprite_size(L, ctx, 1, &w, &h);
-	size_t sz = sprite_size(w,h);
-	struct sprite *spr = (struct sprite *)lua_newuserdatauv(L, sz, 0);
-	spr->w = w;
-	spr->h = h;
-	spr->x = 0;
-	spr->y = 0;
-	spr->kx =0;
-	spr->ky =0;
-	spr->prev = NULL;
-	spr->next = NULL;
-	struct sprite_attribs a;
-	a.transparency = 0;
-	if (lua_getfield(L, 1, "transparency") == LUA_TSTRING) {
-		const char * t = lua_tostring(L, -1);
-		a.transparency = (unsigned)*t;
-		if (a.transparency > 127 || a.transparency == 0) {
-			return luaL_error(L, "transparency is ascii only");
-		}
+	const char *filename = luaL_checkstring(L, 1);
+	struct mapfile *m = (struct mapfile *)lua_newuserdatauv(L, sizeof(*m), 0);
+	memset(m, 0, sizeof(*m));
+	m->prefetch = lua_toboolean(L, 2);
+	if (luaL_newmetatable(L, "RMAPFILE")) {
+		luaL_Reg l[] = {
+			{ "get", lmapfile_get },
+			{ "setpos", lmapfile_setpos },
+			{ "__tostring", lmapfileinfo },
+			{ "visible", NULL },
+			{ "__gc", NULL },
+			{ "__index", NULL },
+			{ NULL, NULL },
+		};
+		luaL_setfuncs(L, l, 0);
+		lua_pushvalue(L, -1);
+		lua_setfield(L, -2, "__index");
+
+		luaL_Reg l2[] = {
+			{ "visible", lmapfile_visible },
+			{ "__gc", lmapfile_gc },
+			{ NULL, NULL },
+		};
+
+		lua_pushvalue(L, lua_upvalueindex(1));
+		luaL_setfuncs(L, l2, 1);
 	}
-	lua_pop(L, 1);
-	a.color = get_color(L, 1, "color", 0xffff, NULL);
-	a.background = get_color(L, 1, "background", 0, &spr->background);
-	a.layer = 1;
-	if (lua_getfield(L, 1, "layer") == LUA_TNUMBER) {
-		int layer = lua_tointeger(L, -1);
-		if (layer < 0)
-			layer = 0;
-		else if (layer > 255)
-			layer = 255;
-		a.layer = layer;
+	lua_setmetatable(L, -2);
+	const char *err = mapfile_open(m, filename);
+	if (err) {
+		mapfile_close(m);
+		return luaL_error(L, "%s map file %s", err, filename);
 	}
-	lua_pop(L, 1);
-	if (lua_getfield(L, 1, "kx") == LUA_TNUMBER) {
-		spr->kx = lua_tointeger(L, -1);
+	mapfile_link(ctx, m);
+	return 1;
+}
+
+static int
+write_padding(FILE *f, long align) {
+	static const char zero[MAPALIGN];
+	long pos = ftell(f);
+	if (pos < 0)
+		return 0;
+	long n = (align - pos % align) % align;
+	return fwrite(zero, 1, n, f) == (size_t)n;
+}
+
+// Save the tilemap m as a map file, index and chunk are the buffers for the chunk index and a chunk
+static int
+save_tilemap(const struct sprite *m, const char *filename, int chunk_w, int chunk_h, uint64_t *index, struct slot *chunk) {
+	int chunks_x = (m->w + chunk_w - 1) / chunk_w;
+	int chunks_y = (m->h + chunk_h - 1) / chunk_h;
+	int n = chunks_x * chunks_y;
+	size_t chunk_bytes = (size_t)chunk_w * chunk_h * sizeof(struct slot);
+	// The chunks are aligned, so each chunk can be paged alone
+	size_t chunk_size = (chunk_bytes + MAPALIGN - 1) & ~(size_t)(MAPALIGN - 1);
+	struct mapfile_header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, "RMAP", 4);
+	h.version = 1;
+	h.width = m->w;
+	h.height = m->h;
+	h.chunk_w = chunk_w;
+	h.chunk_h = chunk_h;
+	uint64_t offset = (sizeof(h) + n * sizeof(uint64_t) + MAPALIGN - 1) & ~(uint64_t)(MAPALIGN - 1);
+	int i,j,k;
+	for (i=0;i<n;i++) {
+		int x = i % chunks_x * chunk_w;
+		int y = i / chunks_x * chunk_h;
+		// The empty chunks are not saved
+		index[i] = 0;
+		for (j=y;j<y+chunk_h && j<(int)m->h && index[i] == 0;j++) {
+			for (k=x;k<x+chunk_w && k<(int)m->w;k++) {
+				if (m->body->s[j * m->w + k].code) {
+					index[i] = offset;
+					offset += chunk_size;
+					break;
+				}
+			}
+		}
 	}
-	lua_pop(L, 1);
-	if (lua_getfield(L, 1, "ky") == LUA_TNUMBER) {
-		spr->ky = lua_tointeger(L, -1);
+	FILE *f = fopen(filename, "wb");
+	if (f == NULL)
+		return 0;
+	int ok = fwrite(&h, sizeof(h), 1, f) == 1 && fwrite(index, sizeof(uint64_t), n, f) == (size_t)n;
+	for (i=0;i<n && ok;i++) {
+		if (index[i] == 0)
+			continue;
+		int x = i % chunks_x * chunk_w;
+		int y = i / chunks_x * chunk_h;
+		int w = (int)m->w - x < chunk_w ? (int)m->w - x : chunk_w;
+		memset(chunk, 0, chunk_bytes);
+		for (j=0;j<chunk_h && y+j<(int)m->h;j++) {
+			memcpy(chunk + j * chunk_w, m->body->s + (y + j) * m->w + x, w * sizeof(struct slot));
+		}
+		ok = write_padding(f, MAPALIGN) && fwrite(chunk, 1, chunk_bytes, f) == chunk_bytes;
 	}
-	lua_pop(L, 1);
+	if (fclose(f) != 0)
+		ok = 0;
+	return ok;
+}
 
-	sprite_graph(L, 1, ctx, spr, &a);
-	if (luaL_newmetatable(L, "RSPRITE")) {
+// tilemap:save(filename [, chunk_w, chunk_h]) saves the tilemap as a map file for c.mapfile
+static int
+ltilemap_save(lua_State *L) {
+	struct sprite *m = getTilemap(L);
+	const char *filename = luaL_checkstring(L, 2);
+	int chunk_w = luaL_optinteger(L, 3, MAPCHUNK);
+	int chunk_h = luaL_optinteger(L, 4, MAPCHUNK);
+	if (chunk_w <= 0 || chunk_w > 0xffff || chunk_h <= 0 || chunk_h > 0xffff)
+		return luaL_error(L, "Invalid chunk size %dx%d", chunk_w, chunk_h);
+	int n = ((m->w + chunk_w - 1) / chunk_w) * ((m->h + chunk_h - 1) / chunk_h);
+	uint64_t *index = (uint64_t *)lua_newuserdatauv(L, n * sizeof(uint64_t) + (size_t)chunk_w * chunk_h * sizeof(struct slot), 0);
+	if (!save_tilemap(m, filename, chunk_w, chunk_h, index, (struct slot *)(index + n)))
+		return luaL_error(L, "Write %s failed", filename);
+	return 0;
+}
+
+// c.tilemap(w, h) creates an empty tilemap at (0, 0), it's drawn under the sprites
+static int
+ltilemap(lua_State *L) {
+	struct context *ctx = getCtx(L);
+	int w = luaL_checkinteger(L, 1);
+	int h = luaL_checkinteger(L, 2);
+	if (w <= 0 || h <= 0 || w > 0x10000 || h > 0x10000 || (int64_t)w * h > 0x10000000)
+		return luaL_error(L, "Invalid tilemap size %dx%d", w, h);
+	size_t sz = sizeof(struct sprite) + body_size(w * h, h, 0, 0);
+	struct sprite *m = (struct sprite *)lua_newuserdatauv(L, sz, 0);
+	memset(m, 0, sz);
+	m->w = w;
+	m->h = h;
+	m->body = (struct body *)(m + 1);	// the body of a tilemap is always dense, and follows the header
+	body_init(m->body, w * h, h, 0, 0);
+	m->background = 1;
+	m->tint = -1;
+	m->serial = ctx->serial++;
+	if (luaL_newmetatable(L, "RTILEMAP")) {
 		luaL_Reg l[] = {
-			{ "setpos", lsetpos },
-			{ "setcolor", lsetcolor },
-			{ "setlayer", lsetlayer },
-			{ "clone", NULL },
+			{ "get", ltilemap_get },
+			{ "save", ltilemap_save },
+			{ "__tostring", ltilemapinfo },
+			{ "set", NULL },
+			{ "setpos", ltilemap_setpos },
 			{ "visible", NULL },
-			{ "__tostring", lspriteinfo },
 			{ "__gc", NULL },
 			{ "__index", NULL },
 			{ NULL, NULL },
@@ -1010,10 +4322,9 @@ lsprite(lua_State *L) {
 		lua_setfield(L, -2, "__index");
 
 		luaL_Reg l2[] = {
-			{ "clone", lclone },
-			{ "visible", lvisible },
-			{ "text", lsettext },
-			{ "__gc", lvisible },
+			{ "set", ltilemap_set },
+			{ "visible", ltilemap_visible },
+			{ "__gc", ltilemap_gc },
 			{ NULL, NULL },
 		};
 
@@ -1021,7 +4332,7 @@ lsprite(lua_State *L) {
 		luaL_setfuncs(L, l2, 1);
 	}
 	lua_setmetatable(L, -2);
-	link_sprite(ctx, spr);
+	list_link(&ctx->tilemap, m);
 	return 1;
 }
 
@@ -1042,6 +4353,94 @@ llayer(lua_State *L) {
 	return 0;
 }
 
+static int
+time_order(const void *a, const void *b) {
+	uint32_t ta = *(const uint32_t *)a;
+	uint32_t tb = *(const uint32_t *)b;
+	return ta < tb ? -1 : (ta > tb);
+}
+
+static int
+lstat(lua_State *L) {
+	struct context * ctx = getCtx(L);
+	lua_newtable(L);
+	lua_pushstring(L, ctx->texture ? "texture" : "surface");
+	lua_setfield(L, -2, "backend");
+	if (ctx->raster.name) {
+		lua_pushstring(L, ctx->raster.name);
+		lua_setfield(L, -2, "kernel");
+	}
+	lua_pushinteger(L, ctx->pool ? ctx->pool->n : 1);
+	lua_setfield(L, -2, "threads");
+	lua_pushinteger(L, ctx->raster.zoom);
+	lua_setfield(L, -2, "zoom");
+	lua_pushstring(L, ctx->topdown ? "topdown" : "painter");
+	lua_setfield(L, -2, "compose");
+	lua_pushinteger(L, SDL_AtomicGet(&ctx->cell_writes));
+	lua_setfield(L, -2, "cell_writes");
+	lua_pushinteger(L, SDL_AtomicGet(&ctx->overdraw));
+	lua_setfield(L, -2, "overdraw");
+	if (ctx->sprites.cap > 0) {
+		lua_pushinteger(L, ctx->sprites.top - ctx->sprites.nfree);
+		lua_setfield(L, -2, "pool_used");
+		lua_pushinteger(L, ctx->sprites.cap);
+		lua_setfield(L, -2, "pool_size");
+	}
+	int frames = ctx->frame_n < FRAMESTAT ? ctx->frame_n : FRAMESTAT;
+	if (frames > 0) {
+		uint32_t t[FRAMESTAT];
+		uint64_t sum = 0;
+		int i;
+		for (i=0;i<frames;i++) {
+			t[i] = ctx->frame_time[i];
+			sum += t[i];
+		}
+		qsort(t, frames, sizeof(uint32_t), time_order);
+		lua_pushnumber(L, sum / 1000.0 / frames);
+		lua_setfield(L, -2, "frame_mean");
+		lua_pushnumber(L, t[(frames * 99 + 99) / 100 - 1] / 1000.0);
+		lua_setfield(L, -2, "frame_p99");
+	}
+	lua_pushinteger(L, ctx->missed);
+	lua_setfield(L, -2, "frame_missed");
+	struct glyph_cache *c = ctx->cache;
+	if (c) {
+		uint64_t hit = 0, miss = 0;
+		int used = 0, size = 0;
+		int i;
+		int n = ctx->pool ? ctx->pool->n : 1;
+		for (i=0;i<n;i++) {
+			c = ctx->pool ? ctx->pool->w[i].cache : ctx->cache;
+			hit += c->hit;
+			miss += c->miss;
+			used += c->n;
+			size += c->size;
+		}
+		lua_pushinteger(L, hit);
+		lua_setfield(L, -2, "cache_hit");
+		lua_pushinteger(L, miss);
+		lua_setfield(L, -2, "cache_miss");
+		lua_pushinteger(L, used);
+		lua_setfield(L, -2, "cache_used");
+		lua_pushinteger(L, size);
+		lua_setfield(L, -2, "cache_size");
+	}
+	return 1;
+}
+
+static int
+lrelease(lua_State *L) {
+	struct context * ctx = (struct context *)lua_touserdata(L, 1);
+	release_pipeline(ctx);
+	if (ctx->pool) {
+		release_pool(ctx->pool);
+		ctx->pool = NULL;
+	}
+	filemap_close(&ctx->font.file[0]);
+	filemap_close(&ctx->font.file[1]);
+	return 0;
+}
+
 LUAMOD_API int
 luaopen_rogue_core(lua_State *L) {
 	luaL_checkversion(L);
@@ -1050,14 +4449,29 @@ luaopen_rogue_core(lua_State *L) {
 		{ "frame", lframe },
 		{ "event", levent },
 		{ "sprite", lsprite },
+		{ "tilemap", ltilemap },
+		{ "mapfile", lmapfile },
 		{ "layer", llayer },
+		{ "setpos_many", lsetpos_many },
+		{ "visible_many", lvisible_many },
+		{ "setlayer_many", lsetlayer_many },
+		{ "spawn", lspawn },
+		{ "despawn", ldespawn },
+		{ "move", lmove },
+		{ "show", lshow },
+		{ "stat", lstat },
 		{ NULL, NULL },
 	};
 	luaL_newlibtable(L, l);
-	struct context *ctx = (struct context *)lua_newuserdatauv(L, sizeof(struct context), 1);
+	struct context *ctx = (struct context *)lua_newuserdatauv(L, sizeof(struct context), 9);
 	memset(ctx, 0, sizeof(*ctx));
+	lua_createtable(L, 0, 1);
+	lua_pushcfunction(L, lrelease);
+	lua_setfield(L, -2, "__gc");
+	lua_setmetatable(L, -2);
 	ctx->mousex = -1;
 	ctx->mousey = -1;
+	ctx->raster.font = &builtin_font;
 	luaL_setfuncs(L,l,1);
 	return 1;
 }
@@ -142,6 +142,6 @@ end
 while dispatch(c.event()) do
 	s:setpos(x,y)
 	title:setpos(x, y)
-	title:text(string.format("x = %d\ny = %d", x, y))
+	title:format("x = %d\ny = %d", x, y)
 	c.frame(camera_x, camera_y)
 end
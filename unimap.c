@@ -0,0 +1,64 @@
+// Generate unimap.h, the glyph index of each unicode in BMP, from the charsets.
+// gcc -o unimap unimap.c && ./unimap > unimap.h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define CHARSET_UNICODE
+#include "charset_cp437.h"
+#include "charset_cp936.h"
+
+#define MISSING 255
+
+static uint16_t map[0x10000];
+static int page[256];
+static int block[256];	// the page of each block
+
+int
+main() {
+	int i,j;
+	for (i=0;i<0x10000;i++) {
+		map[i] = i < 128 ? i : MISSING;
+	}
+	// cp936 first, cp437 overwrites it
+	for (i=0;i<sizeof(unimap_cp936)/sizeof(unimap_cp936[0]);i++) {
+		map[(uint16_t)unimap_cp936[i]] = i + 256;
+	}
+	for (i=0;i<sizeof(cp437_unicode)/sizeof(cp437_unicode[0]);i++) {
+		map[cp437_unicode[i]] = cp437_index[i];
+	}
+	// block 0 is the empty page
+	int n = 1;
+	block[0] = -1;
+	for (i=0;i<256;i++) {
+		page[i] = 0;
+		for (j=0;j<256;j++) {
+			if (map[i * 256 + j] != MISSING) {
+				page[i] = n;
+				block[n++] = i;
+				break;
+			}
+		}
+	}
+	if (n > 256) {
+		fprintf(stderr, "Too many pages %d\n", n);
+		return 1;
+	}
+	printf("// Generated by unimap.c from charset_cp437.h and charset_cp936.h, don't edit.\n");
+	printf("// The glyph index of the unicode u (in BMP) is unimap_block[unimap_page[u >> 8]][u & 0xff], %d for the missing ones.\n\n", MISSING);
+	printf("static const uint8_t unimap_page[256] = {");
+	for (i=0;i<256;i++) {
+		printf("%s%d,", i % 16 == 0 ? "\n" : "", page[i]);
+	}
+	printf("\n};\n\nstatic const uint16_t unimap_block[%d][256] = {\n", n);
+	for (i=0;i<n;i++) {
+		printf("{");
+		for (j=0;j<256;j++) {
+			printf("%s%d,", j % 16 == 0 ? "\n" : "", block[i] < 0 ? MISSING : map[block[i] * 256 + j]);
+		}
+		printf("\n},\n");
+	}
+	printf("};\n");
+	return 0;
+}
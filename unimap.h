@@ -0,0 +1,1788 @@
+// Generated by unimap.c from charset_cp437.h and charset_cp936.h, don't edit.
+// The glyph index of the unicode u (in BMP) is unimap_block[unimap_page[u >> 8]][u & 0xff], 255 for the missing ones.
+
+static const uint8_t unimap_page[256] = {
+1,2,3,4,5,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+6,7,8,9,10,11,12,0,0,0,0,0,0,0,0,0,
+13,14,15,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,17,
+18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,
+34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,
+50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,
+66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,
+82,83,84,85,86,87,88,89,90,91,92,93,94,0,95,96,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,
+};
+
+static const uint16_t unimap_block[98][256] = {
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,
+80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,173,155,156,256,157,255,21,258,255,166,174,170,255,255,255,
+248,241,253,255,255,230,20,250,255,255,167,175,172,171,255,168,
+255,255,255,255,142,143,146,128,255,144,255,255,255,255,255,255,
+255,165,255,255,255,255,153,262,255,255,255,255,154,255,255,225,
+133,160,131,255,132,134,145,135,138,130,136,137,141,161,140,139,
+255,164,149,162,147,255,148,246,255,151,163,150,129,255,255,152,
+},
+{
+255,276,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,277,255,255,255,255,255,255,255,278,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,279,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,280,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,281,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,159,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,282,255,
+283,255,284,255,285,255,286,255,287,255,288,255,289,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,290,255,291,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,292,293,226,295,296,297,298,233,300,301,302,303,304,305,306,
+307,308,255,228,310,311,232,313,314,234,255,255,255,255,255,255,
+255,224,317,318,235,238,321,322,323,324,325,326,327,328,329,330,
+227,332,255,229,231,335,237,337,338,339,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,340,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,
+357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,
+373,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,
+389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,
+255,405,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,406,255,407,255,408,409,255,255,410,411,255,255,
+255,255,7,255,255,255,412,255,255,255,255,255,255,255,255,255,
+413,255,414,415,255,255,255,255,255,255,255,416,19,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,252,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,158,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,417,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,418,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+419,420,421,422,423,424,425,426,427,428,429,430,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+27,24,26,25,29,18,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,23,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,435,255,255,255,255,255,255,436,
+255,437,255,255,255,255,255,255,255,249,251,255,255,439,236,239,
+441,255,255,255,255,442,255,443,444,247,446,447,255,255,448,255,
+255,255,255,255,449,450,451,452,255,255,255,255,255,453,255,255,
+255,255,255,255,255,255,255,255,240,255,255,255,455,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+456,243,255,255,242,169,255,255,255,255,255,255,255,255,460,461,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,462,255,255,255,255,255,255,
+255,255,255,255,255,463,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+28,255,464,255,255,255,255,255,255,255,255,255,255,255,255,255,
+244,245,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+465,466,467,468,469,470,471,472,473,474,255,255,255,255,255,255,
+255,255,255,255,475,476,477,478,479,480,481,482,483,484,485,486,
+487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,
+503,504,505,506,507,508,509,510,511,512,513,514,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+196,516,179,518,519,520,521,522,523,524,525,526,218,528,529,530,
+191,532,533,534,192,536,537,538,217,540,541,542,195,544,545,546,
+547,548,549,550,180,552,553,554,555,556,557,558,194,560,561,562,
+563,564,565,566,193,568,569,570,571,572,573,574,197,576,577,578,
+579,580,581,582,583,584,585,586,587,588,589,590,255,255,255,255,
+205,186,213,214,201,184,183,187,212,211,200,190,189,188,198,199,
+204,181,182,185,209,210,203,207,208,202,216,215,206,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+223,255,255,255,220,255,255,255,219,255,255,255,221,255,255,255,
+222,176,177,178,255,255,255,255,255,255,255,255,255,255,255,255,
+254,592,255,255,255,255,255,255,255,255,255,255,22,255,255,255,
+255,255,30,594,255,255,255,255,255,255,16,255,31,255,255,255,
+255,255,255,255,17,255,595,596,255,255,255,9,255,255,598,599,
+255,255,255,255,255,255,255,255,8,10,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,600,601,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,1,2,15,255,255,255,
+12,255,11,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+6,255,255,5,255,3,4,255,255,255,13,14,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+604,605,606,607,255,608,255,255,609,610,611,612,613,614,615,616,
+617,618,255,619,620,621,622,623,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,
+639,640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,
+655,656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,
+671,672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,
+687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,
+703,704,705,706,255,255,255,255,255,255,255,255,255,255,255,255,
+255,707,708,709,710,711,712,713,714,715,716,717,718,719,720,721,
+722,723,724,725,726,727,728,729,730,731,732,733,734,735,736,737,
+738,739,740,741,742,743,744,745,746,747,748,749,750,751,752,753,
+754,755,756,757,758,759,760,761,762,763,764,765,766,767,768,769,
+770,771,772,773,774,775,776,777,778,779,780,781,782,783,784,785,
+786,787,788,789,790,791,792,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,793,794,795,796,797,798,799,800,801,802,803,
+804,805,806,807,808,809,810,811,812,813,814,815,816,817,818,819,
+820,821,822,823,824,825,826,827,828,829,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+830,831,832,833,834,835,836,837,838,839,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+840,841,255,842,255,255,255,843,844,845,846,847,848,849,850,255,
+851,852,255,853,854,855,856,255,857,858,859,860,861,862,863,255,
+255,255,864,255,865,866,255,867,868,255,869,870,871,872,255,255,
+873,255,874,255,875,255,876,255,877,878,879,880,255,881,882,883,
+255,255,255,884,255,885,255,886,887,888,255,889,890,891,892,893,
+894,255,895,896,897,255,898,255,899,900,255,255,901,902,903,904,
+905,906,255,255,255,255,907,255,255,908,255,255,255,255,255,255,
+909,910,255,911,255,255,255,255,255,255,255,255,255,255,912,255,
+255,255,255,255,255,255,913,255,914,915,255,916,917,918,919,920,
+255,921,922,923,924,925,255,255,926,255,927,928,255,255,255,929,
+930,931,932,255,933,934,935,936,937,938,255,939,940,941,942,255,
+255,255,943,944,255,945,255,255,255,255,946,947,255,255,255,948,
+949,950,951,952,953,954,955,956,255,957,958,959,255,960,961,255,
+255,962,255,963,964,965,966,967,968,969,255,255,255,970,971,972,
+255,973,255,974,975,976,255,255,977,255,978,979,980,255,255,255,
+981,255,982,983,255,984,985,986,255,255,255,987,255,988,255,989,
+},
+{
+255,990,255,255,255,255,255,255,255,991,992,255,255,993,994,995,
+996,997,255,255,255,255,255,998,999,1000,1001,1002,255,255,1003,1004,
+1005,255,1006,255,1007,1008,1009,1010,255,255,1011,1012,255,255,255,1013,
+1014,255,1015,255,1016,255,1017,255,1018,255,1019,255,1020,1021,255,255,
+255,255,255,1022,255,255,1023,255,255,255,255,255,255,1024,1025,1026,
+1027,1028,255,1029,255,1030,255,1031,1032,1033,1034,1035,1036,1037,1038,1039,
+1040,255,255,1041,1042,1043,255,1044,255,1045,255,255,1046,255,255,1047,
+1048,255,255,1049,1050,255,1051,255,255,255,255,1052,1053,255,1054,1055,
+255,255,255,1056,1057,255,255,255,1058,1059,255,1060,255,1061,255,1062,
+255,1063,255,255,1064,255,255,1065,255,255,255,1066,255,1067,255,255,
+1068,255,255,1069,255,1070,1071,1072,1073,1074,1075,255,1076,255,1077,1078,
+255,255,255,255,255,1079,255,255,255,255,255,255,255,255,255,1080,
+255,255,255,1081,1082,1083,255,255,255,255,1084,255,255,255,1085,1086,
+1087,1088,255,255,255,255,255,1089,1090,255,1091,255,1092,1093,1094,1095,
+255,1096,255,1097,255,255,1098,255,1099,1100,1101,255,255,1102,1103,1104,
+255,1105,255,1106,255,255,255,255,1107,255,1108,255,255,255,1109,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,1110,1111,255,1112,
+255,255,1113,255,1114,255,255,255,1115,1116,1117,255,1118,255,255,1119,
+255,1120,255,255,255,1121,1122,255,1123,1124,1125,255,1126,1127,1128,255,
+255,255,255,255,255,255,255,255,255,255,1129,255,1130,255,1131,255,
+255,255,255,1132,255,255,255,1133,1134,255,255,255,1135,255,1136,1137,
+255,255,255,255,255,1138,255,255,255,255,1139,255,1140,255,255,255,
+255,255,255,255,255,1141,255,255,255,255,255,255,1142,255,255,255,
+255,255,255,255,255,255,1143,1144,255,255,255,1145,255,255,1146,1147,
+1148,255,255,255,255,1149,255,255,1150,255,255,255,255,1151,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,1152,255,1153,255,1154,1155,1156,255,255,1157,255,255,255,
+255,255,1158,255,255,255,255,255,255,255,1159,1160,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,1161,
+255,255,255,255,255,255,1162,255,255,255,1163,255,255,255,255,255,
+255,255,255,255,255,255,1164,1165,255,255,255,255,1166,1167,1168,255,
+255,255,255,1169,255,1170,255,255,255,255,255,1171,255,255,255,255,
+},
+{
+255,255,255,255,255,255,1172,1173,255,255,255,1174,255,255,255,255,
+255,255,1175,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,1176,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,1177,
+1178,1179,255,1180,1181,1182,1183,255,1184,1185,255,1186,255,1187,255,255,
+255,1188,255,255,1189,1190,1191,255,255,255,1192,255,1193,255,255,255,
+255,255,1194,255,255,1195,255,255,1196,255,255,1197,1198,1199,1200,255,
+1201,1202,255,1203,1204,1205,1206,1207,1208,1209,255,1210,1211,1212,255,255,
+1213,1214,1215,255,255,1216,255,255,1217,1218,255,255,1219,1220,255,255,
+255,255,1221,255,255,1222,1223,1224,255,1225,255,1226,1227,255,255,255,
+1228,255,1229,255,1230,1231,255,255,255,255,255,1232,1233,255,255,1234,
+1235,1236,1237,1238,255,1239,1240,1241,255,255,255,1242,1243,1244,255,255,
+1245,255,255,255,1246,255,1247,1248,255,1249,255,1250,1251,255,255,1252,
+255,1253,255,255,255,255,255,255,255,255,255,1254,255,1255,255,255,
+1256,1257,255,255,1258,255,255,255,255,255,255,1259,255,1260,255,1261,
+1262,255,255,1263,255,1264,1265,255,1266,1267,1268,1269,1270,1271,255,1272,
+},
+{
+1273,1274,1275,1276,255,255,1277,1278,1279,255,1280,255,255,1281,1282,255,
+255,1283,1284,255,255,255,1285,1286,1287,1288,1289,1290,255,1291,255,255,
+1292,255,255,255,1293,255,255,255,1294,1295,255,1296,255,1297,1298,255,
+1299,255,255,1300,255,255,1301,1302,1303,1304,1305,1306,255,1307,255,1308,
+1309,1310,1311,1312,255,255,255,255,255,255,1313,255,1314,1315,255,255,
+1316,1317,255,255,1318,255,1319,255,255,255,255,255,1320,255,1321,255,
+255,1322,255,255,255,1323,255,1324,255,1325,1326,255,255,255,255,1327,
+255,255,1328,255,255,255,255,255,255,255,255,255,255,1329,255,1330,
+255,1331,1332,255,255,255,255,255,1333,255,255,255,255,255,255,255,
+1334,255,255,1335,255,255,255,255,255,255,255,1336,255,1337,1338,1339,
+1340,1341,1342,1343,255,255,255,255,1344,1345,1346,1347,1348,1349,255,255,
+255,1350,1351,1352,255,255,255,255,255,255,255,255,255,255,1353,1354,
+255,255,255,1355,255,255,255,1356,255,1357,255,1358,255,255,255,255,
+1359,255,1360,255,255,255,1361,255,1362,255,255,255,255,255,255,1363,
+255,255,255,255,1364,255,255,255,255,255,255,255,255,255,255,255,
+1365,255,255,255,255,255,255,255,255,1366,1367,255,255,255,1368,1369,
+},
+{
+1370,255,255,255,255,1371,1372,255,1373,255,255,255,255,1374,255,1375,
+1376,255,255,255,255,1377,1378,1379,255,1380,1381,255,255,1382,255,255,
+1383,1384,255,1385,255,255,1386,255,255,255,1387,255,255,255,1388,255,
+255,255,255,255,255,255,255,255,255,1389,1390,1391,255,255,1392,1393,
+255,1394,255,1395,255,1396,255,1397,1398,1399,1400,255,255,255,1401,1402,
+255,1403,1404,1405,255,1406,1407,1408,255,255,1409,255,1410,255,1411,1412,
+1413,1414,1415,1416,1417,255,1418,1419,255,1420,255,1421,255,255,1422,1423,
+1424,1425,255,1426,1427,1428,255,1429,1430,255,1431,255,255,255,255,1432,
+255,255,1433,255,1434,1435,1436,255,255,1437,255,1438,1439,1440,255,255,
+255,255,255,255,255,1441,255,255,1442,255,1443,255,255,1444,255,1445,
+255,255,1446,1447,255,1448,1449,255,1450,1451,255,255,255,255,1452,255,
+255,255,255,255,255,255,1453,255,255,255,255,1454,255,255,255,1455,
+255,1456,1457,255,255,255,255,255,1458,1459,1460,1461,1462,1463,255,255,
+255,1464,255,255,1465,255,1466,1467,1468,1469,255,1470,255,255,255,1471,
+1472,255,255,1473,1474,1475,1476,255,1477,1478,1479,1480,1481,1482,1483,1484,
+1485,1486,1487,1488,255,1489,1490,1491,1492,1493,255,1494,1495,1496,255,255,
+},
+{
+255,1497,255,1498,1499,255,1500,255,1501,1502,1503,255,1504,1505,1506,1507,
+1508,1509,1510,1511,255,1512,1513,1514,255,255,255,1515,255,1516,1517,1518,
+1519,1520,255,1521,255,255,1522,1523,1524,1525,255,1526,1527,1528,1529,1530,
+255,1531,1532,255,1533,1534,255,255,1535,1536,255,1537,1538,255,1539,255,
+1540,255,255,1541,255,255,1542,255,1543,255,1544,1545,255,255,255,255,
+1546,255,1547,1548,1549,1550,1551,1552,1553,1554,255,1555,1556,255,255,255,
+255,255,1557,255,1558,255,1559,255,1560,255,255,255,255,255,255,255,
+255,1561,1562,1563,255,1564,1565,1566,1567,255,255,1568,1569,1570,255,255,
+1571,255,1572,255,1573,255,1574,255,255,255,255,1575,1576,255,1577,1578,
+1579,255,1580,255,1581,1582,1583,255,255,1584,1585,1586,255,1587,255,255,
+255,255,255,1588,1589,255,1590,1591,1592,1593,1594,1595,1596,1597,255,1598,
+255,1599,255,1600,1601,255,255,255,1602,255,255,1603,255,1604,255,1605,
+1606,1607,1608,255,1609,255,1610,1611,1612,1613,255,255,1614,1615,1616,1617,
+1618,1619,1620,1621,1622,1623,255,1624,255,1625,1626,255,1627,1628,1629,1630,
+255,255,255,255,255,1631,1632,1633,1634,1635,1636,255,255,1637,1638,255,
+255,255,1639,1640,255,255,255,255,255,255,1641,255,1642,1643,255,1644,
+},
+{
+255,1645,255,255,255,255,1646,1647,255,1648,255,255,255,255,255,1649,
+1650,1651,255,255,1652,255,255,255,255,255,255,1653,255,255,255,255,
+1654,255,1655,1656,1657,255,255,1658,255,255,1659,255,1660,255,1661,1662,
+1663,1664,255,1665,255,255,255,1666,255,255,255,255,1667,255,1668,1669,
+255,1670,255,1671,1672,255,1673,255,255,1674,1675,255,255,255,255,255,
+1676,255,255,255,255,1677,1678,255,255,255,255,255,1679,255,255,255,
+255,1680,255,255,1681,1682,1683,1684,255,255,1685,255,1686,1687,1688,255,
+255,255,255,255,255,1689,1690,1691,1692,255,255,1693,1694,255,1695,255,
+1696,1697,1698,1699,1700,255,255,1701,1702,1703,1704,1705,255,255,255,1706,
+255,1707,255,255,1708,255,255,255,1709,1710,255,255,1711,1712,255,1713,
+255,255,255,255,255,255,255,1714,255,255,255,255,255,255,255,255,
+255,1715,255,1716,255,1717,255,1718,255,1719,255,1720,255,1721,1722,255,
+255,255,255,255,1723,1724,255,255,255,1725,255,255,1726,1727,255,255,
+255,1728,1729,1730,1731,255,1732,255,255,255,255,255,1733,1734,255,1735,
+255,1736,255,1737,1738,1739,1740,255,1741,255,1742,1743,1744,255,255,1745,
+255,255,1746,1747,255,1748,255,1749,255,255,255,255,255,1750,1751,255,
+},
+{
+1752,1753,255,255,255,255,255,255,1754,1755,255,255,1756,255,1757,1758,
+255,255,255,255,255,255,255,255,1759,255,255,1760,255,255,1761,1762,
+255,255,255,1763,1764,255,255,1765,255,255,255,255,1766,1767,255,255,
+255,1768,1769,255,1770,255,1771,255,255,1772,255,1773,255,255,255,1774,
+255,255,255,255,255,255,255,255,255,255,255,255,1775,1776,1777,255,
+255,255,255,255,1778,255,255,1779,1780,1781,255,255,1782,255,255,255,
+255,255,1783,255,1784,255,255,255,1785,1786,1787,1788,1789,255,255,255,
+255,1790,255,255,255,255,1791,255,255,255,255,1792,1793,255,255,255,
+255,255,255,255,255,1794,1795,255,255,255,255,255,255,255,1796,1797,
+255,255,255,1798,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,1799,255,255,255,255,255,255,255,255,255,255,255,1800,
+255,255,255,255,255,255,255,1801,255,255,255,255,1802,255,255,255,
+255,255,255,255,255,255,255,255,255,255,1803,255,255,255,255,255,
+255,255,255,255,1804,255,255,1805,255,255,1806,1807,255,1808,1809,1810,
+1811,1812,1813,255,1814,255,255,255,255,255,255,1815,255,1816,255,255,
+1817,1818,255,255,1819,1820,255,255,255,1821,1822,255,255,1823,1824,1825,
+},
+{
+255,255,255,1826,1827,255,1828,255,1829,1830,1831,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,1832,255,255,1833,
+255,255,255,1834,255,255,255,255,1835,1836,1837,255,1838,1839,1840,1841,
+1842,255,255,1843,255,255,255,255,255,1844,1845,1846,255,255,1847,255,
+1848,255,1849,255,255,255,255,1850,255,255,1851,255,1852,1853,1854,1855,
+1856,1857,255,255,255,255,255,1858,255,255,1859,1860,1861,1862,1863,1864,
+1865,1866,255,255,1867,255,1868,255,1869,1870,1871,1872,255,1873,255,1874,
+255,255,255,1875,255,255,1876,1877,255,255,255,1878,1879,255,255,255,
+255,255,1880,1881,1882,1883,1884,255,255,255,255,1885,1886,255,255,255,
+255,255,1887,1888,255,255,255,255,255,255,255,1889,255,255,255,255,
+1890,1891,1892,1893,1894,255,1895,1896,255,1897,255,1898,255,1899,1900,255,
+255,255,1901,255,1902,255,255,255,1903,255,255,255,255,255,255,255,
+255,255,1904,1905,255,255,255,255,255,255,255,1906,255,255,1907,1908,
+255,255,1909,255,1910,1911,255,255,1912,1913,1914,255,255,1915,255,1916,
+1917,255,255,255,1918,255,255,255,255,255,255,255,255,1919,255,1920,
+255,255,255,255,1921,255,255,255,1922,1923,1924,255,255,1925,255,255,
+},
+{
+1926,255,1927,255,255,255,1928,1929,255,255,255,1930,255,1931,255,255,
+255,1932,255,255,255,1933,255,255,255,1934,255,255,255,255,1935,255,
+1936,1937,255,255,1938,255,255,255,255,255,1939,255,255,255,255,255,
+1940,255,255,255,255,1941,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,1942,255,255,255,255,255,255,255,1943,1944,255,255,
+255,1945,255,255,1946,255,255,255,1947,255,255,255,255,255,1948,255,
+255,255,255,255,255,1949,255,255,255,255,255,1950,1951,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,1952,255,
+1953,1954,255,1955,255,1956,255,255,255,1957,255,255,255,255,255,255,
+255,255,1958,1959,255,255,255,255,255,1960,1961,255,255,255,1962,1963,
+255,255,255,255,255,255,255,255,1964,1965,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,1966,255,255,255,
+255,1967,255,255,255,1968,255,255,255,255,255,255,255,255,255,255,
+255,1969,255,255,255,1970,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,1971,255,255,255,255,255,255,1972,1973,255,1974,255,
+1975,255,255,1976,255,255,1977,255,255,1978,255,255,255,255,255,255,
+},
+{
+255,255,1979,255,1980,255,255,1981,255,255,255,255,255,1982,255,1983,
+255,255,255,255,1984,1985,1986,255,255,1987,1988,255,1989,255,255,1990,
+255,255,255,255,1991,1992,255,1993,255,1994,1995,1996,255,1997,1998,1999,
+255,2000,255,255,2001,255,255,2002,2003,2004,2005,255,2006,255,255,255,
+255,2007,2008,255,2009,255,255,2010,2011,2012,255,2013,255,255,2014,2015,
+255,2016,255,255,2017,2018,2019,2020,2021,255,2022,255,255,255,255,255,
+2023,255,2024,255,255,2025,255,255,255,255,255,255,255,255,255,255,
+255,255,255,2026,2027,255,2028,255,2029,2030,255,255,255,2031,255,255,
+255,2032,2033,2034,2035,255,2036,2037,2038,255,2039,255,255,2040,255,255,
+255,255,2041,2042,255,255,2043,2044,255,2045,255,255,255,255,2046,255,
+255,255,255,2047,2048,2049,255,255,2050,2051,2052,2053,255,255,2054,2055,
+255,255,2056,255,255,255,255,255,255,2057,255,2058,255,255,2059,255,
+255,255,255,255,255,255,2060,255,255,255,2061,2062,255,255,255,255,
+2063,2064,2065,2066,2067,255,255,2068,2069,255,2070,255,2071,2072,255,255,
+255,255,255,2073,255,2074,255,255,2075,255,255,255,2076,255,255,255,
+255,255,255,255,255,255,255,255,255,2077,255,2078,255,255,255,2079,
+},
+{
+255,2080,255,2081,2082,2083,2084,2085,2086,2087,255,255,2088,255,255,255,
+255,2089,255,2090,255,255,255,255,2091,255,255,255,2092,255,255,2093,
+2094,255,255,2095,255,2096,255,255,255,2097,255,255,255,255,255,255,
+255,2098,2099,255,2100,255,2101,255,255,255,255,255,2102,255,255,255,
+2103,255,255,255,255,255,2104,255,255,2105,2106,255,255,255,255,255,
+255,255,255,255,255,2107,255,255,255,255,2108,255,255,255,255,255,
+255,255,2109,255,255,255,255,2110,255,255,2111,255,255,255,255,255,
+255,255,255,255,2112,2113,2114,2115,255,255,2116,255,255,255,255,2117,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,2118,255,255,255,255,255,255,255,2119,2120,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,2121,255,255,255,255,255,
+255,255,2122,2123,255,2124,255,255,2125,255,255,255,255,255,2126,255,
+255,2127,2128,255,255,255,255,255,255,2129,255,255,2130,255,255,255,
+255,255,2131,255,2132,255,2133,255,2134,255,255,255,2135,255,255,255,
+2136,2137,255,2138,255,255,2139,255,255,2140,255,2141,255,255,255,255,
+255,2142,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,2143,255,255,255,255,255,255,
+255,255,255,255,255,255,2144,2145,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,2146,255,2147,255,255,2148,255,255,255,255,255,255,255,255,
+2149,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+2150,2151,255,2152,2153,2154,255,2155,2156,2157,2158,2159,2160,2161,255,2162,
+255,255,2163,2164,2165,2166,2167,255,255,2168,2169,255,2170,255,255,255,
+2171,2172,255,2173,255,2174,255,255,255,255,2175,255,255,2176,255,255,
+2177,2178,255,2179,2180,2181,255,2182,2183,2184,255,2185,2186,255,255,2187,
+255,255,255,2188,255,2189,255,2190,2191,2192,2193,2194,2195,2196,2197,255,
+2198,2199,2200,2201,2202,2203,2204,255,255,255,2205,2206,255,255,255,255,
+2207,255,255,2208,2209,2210,2211,255,2212,2213,255,255,255,2214,2215,2216,
+255,255,2217,255,2218,2219,2220,2221,255,255,255,255,2222,255,255,255,
+2223,255,2224,2225,255,255,255,255,255,255,255,255,255,2226,2227,2228,
+255,2229,255,255,2230,2231,255,255,2232,255,255,255,255,255,2233,255,
+2234,255,255,255,255,255,255,255,2235,2236,2237,2238,2239,255,255,2240,
+},
+{
+255,2241,255,255,2242,255,2243,255,255,2244,2245,255,255,255,255,2246,
+255,2247,255,255,2248,2249,2250,255,2251,255,2252,255,2253,2254,255,255,
+255,255,2255,255,2256,2257,255,2258,255,255,255,255,2259,255,255,255,
+255,2260,255,255,2261,255,255,255,2262,2263,2264,2265,2266,2267,2268,2269,
+2270,2271,2272,255,255,2273,255,255,2274,2275,2276,2277,255,255,2278,2279,
+2280,2281,255,255,255,2282,255,255,255,2283,255,255,255,255,2284,255,
+2285,2286,255,2287,255,2288,2289,255,255,255,255,255,255,255,2290,2291,
+255,2292,255,255,255,255,255,255,255,2293,2294,255,255,255,255,2295,
+255,2296,2297,255,255,255,255,255,2298,255,255,255,2299,2300,255,255,
+2301,2302,255,255,2303,255,2304,2305,2306,2307,2308,2309,2310,255,255,255,
+255,255,2311,2312,255,255,255,255,255,2313,255,2314,2315,2316,255,255,
+255,2317,255,2318,255,2319,255,2320,2321,255,255,255,255,2322,255,2323,
+255,2324,255,255,2325,255,255,255,255,255,255,2326,255,255,255,255,
+255,255,2327,255,255,255,255,255,255,2328,255,255,255,255,255,255,
+255,2329,255,255,2330,2331,2332,255,2333,255,2334,255,255,2335,255,255,
+2336,255,255,255,255,255,255,255,255,255,255,2337,255,255,255,255,
+},
+{
+255,255,2338,2339,255,255,2340,2341,255,255,255,255,255,255,2342,255,
+255,255,255,255,2343,255,2344,255,255,255,255,2345,255,255,2346,255,
+255,255,255,255,2347,255,2348,2349,255,2350,255,255,255,2351,2352,255,
+255,255,255,255,2353,255,255,255,255,255,255,255,255,2354,2355,255,
+255,255,255,255,255,255,255,2356,255,255,2357,2358,2359,255,255,255,
+255,255,255,255,255,255,255,255,2360,255,255,2361,255,2362,255,255,
+255,255,255,255,255,255,255,255,255,2363,255,2364,2365,255,255,2366,
+255,255,255,255,2367,255,255,255,255,255,255,255,255,255,255,255,
+255,255,2368,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,2369,255,255,255,2370,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,2371,255,255,255,255,255,255,255,255,
+255,255,255,255,255,2372,255,255,255,255,255,255,255,2373,255,255,
+255,255,255,255,255,255,255,255,255,255,255,2374,255,2375,2376,255,
+255,2377,2378,255,255,2379,2380,2381,2382,2383,255,2384,255,255,2385,2386,
+255,2387,2388,2389,2390,255,255,2391,255,255,255,255,255,2392,2393,255,
+},
+{
+255,2394,2395,2396,255,2397,2398,255,2399,255,255,255,2400,255,255,2401,
+2402,2403,255,255,2404,2405,2406,255,2407,2408,2409,2410,2411,2412,255,255,
+255,255,255,255,255,255,2413,2414,255,255,255,255,255,2415,2416,255,
+255,2417,255,255,255,255,255,2418,2419,255,255,2420,2421,2422,255,255,
+255,255,2423,255,2424,2425,255,255,255,255,255,255,2426,255,255,255,
+255,255,255,255,2427,2428,255,255,255,255,255,2429,255,255,2430,255,
+255,2431,2432,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,2433,2434,2435,255,2436,255,2437,255,2438,2439,2440,2441,255,2442,
+2443,255,255,255,2444,255,2445,2446,255,255,2447,2448,255,255,255,2449,
+2450,2451,255,2452,2453,2454,2455,2456,255,2457,2458,255,2459,255,2460,2461,
+2462,255,255,255,255,2463,2464,2465,255,255,255,255,255,2466,255,255,
+255,255,255,2467,255,2468,2469,2470,2471,2472,255,255,255,255,2473,255,
+255,255,255,255,255,255,255,255,255,2474,2475,255,255,255,255,255,
+255,2476,2477,2478,255,255,2479,255,255,255,255,2480,255,255,255,255,
+255,255,255,255,255,255,255,255,2481,255,2482,255,255,255,255,255,
+255,255,255,255,2483,255,2484,2485,255,255,2486,255,255,255,2487,2488,
+},
+{
+2489,2490,2491,2492,2493,255,255,255,2494,255,2495,2496,255,255,255,2497,
+255,2498,255,2499,255,2500,255,2501,2502,255,255,2503,255,255,255,2504,
+2505,255,255,255,255,2506,2507,2508,255,2509,2510,255,255,2511,255,2512,
+255,2513,255,255,255,255,255,255,255,2514,2515,255,2516,255,255,255,
+2517,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+2518,255,2519,2520,255,2521,2522,2523,2524,255,255,255,255,2525,255,255,
+255,2526,2527,255,2528,255,2529,255,255,2530,2531,255,2532,2533,255,255,
+2534,2535,255,2536,255,255,255,2537,255,2538,255,2539,2540,255,255,255,
+2541,2542,2543,255,2544,2545,255,2546,2547,2548,2549,2550,2551,255,255,255,
+2552,255,2553,255,255,2554,255,2555,2556,2557,255,255,2558,255,255,255,
+255,2559,255,255,255,255,255,255,2560,255,2561,255,255,2562,2563,255,
+255,255,255,255,255,2564,255,2565,255,255,255,255,2566,2567,255,255,
+255,255,255,2568,2569,2570,2571,255,255,2572,255,255,2573,2574,255,2575,
+2576,2577,2578,255,255,255,2579,2580,2581,2582,255,255,255,2583,255,255,
+2584,2585,255,255,2586,255,255,2587,255,255,2588,2589,255,2590,2591,255,
+255,2592,255,255,255,2593,255,255,2594,255,255,2595,255,2596,2597,2598,
+},
+{
+2599,2600,2601,2602,2603,2604,2605,255,255,255,2606,255,255,2607,2608,2609,
+255,255,2610,255,2611,2612,2613,255,255,2614,255,2615,2616,2617,255,255,
+2618,2619,255,255,255,2620,2621,2622,2623,2624,2625,2626,255,255,255,2627,
+255,255,255,255,255,2628,255,255,255,255,255,2629,2630,255,255,2631,
+255,2632,2633,2634,255,255,255,255,255,255,255,2635,255,2636,255,255,
+2637,255,2638,255,255,2639,255,255,255,2640,2641,255,255,2642,255,255,
+255,255,2643,2644,2645,255,255,2646,2647,2648,2649,2650,2651,2652,255,2653,
+2654,255,255,2655,255,255,2656,255,2657,2658,2659,2660,2661,2662,255,2663,
+255,255,255,2664,2665,255,255,255,255,2666,255,255,2667,2668,255,255,
+255,255,2669,255,2670,255,2671,255,255,255,2672,2673,255,2674,255,2675,
+2676,255,255,2677,255,255,2678,255,2679,255,255,2680,2681,2682,255,2683,
+255,2684,2685,255,2686,255,255,255,2687,255,255,2688,2689,255,255,255,
+255,255,255,255,255,2690,2691,255,255,255,2692,2693,255,255,255,255,
+255,2694,255,255,255,2695,255,255,2696,255,2697,255,2698,2699,255,2700,
+2701,255,255,255,255,255,2702,2703,2704,2705,255,2706,2707,2708,2709,2710,
+2711,255,255,2712,2713,255,2714,255,255,2715,2716,255,255,255,255,255,
+},
+{
+2717,2718,255,255,255,255,2719,255,2720,2721,255,255,255,2722,2723,2724,
+255,255,255,255,255,2725,255,255,255,255,2726,255,255,255,255,2727,
+2728,255,255,2729,2730,255,2731,2732,255,255,255,2733,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,2734,
+255,255,255,255,255,255,255,255,2735,255,2736,255,2737,255,2738,255,
+255,2739,255,255,255,2740,255,255,255,255,255,255,255,2741,255,255,
+255,255,2742,255,255,255,255,2743,2744,255,255,255,255,255,255,255,
+2745,255,255,255,255,2746,255,2747,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,2748,255,255,2749,255,
+255,255,255,255,2750,255,255,255,255,255,255,255,255,2751,255,255,
+255,255,255,255,255,255,255,2752,2753,2754,255,255,2755,255,255,255,
+255,255,255,255,255,255,255,2756,255,255,255,255,255,255,2757,255,
+255,255,2758,255,255,255,255,255,2759,255,2760,2761,255,255,255,255,
+255,2762,2763,255,2764,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,2765,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,2766,255,255,255,255,255,255,255,255,255,2767,
+},
+{
+255,255,255,255,255,255,2768,255,2769,255,2770,2771,2772,2773,2774,2775,
+2776,2777,2778,255,255,2779,2780,2781,2782,255,2783,2784,255,255,255,2785,
+255,2786,2787,255,2788,2789,255,255,255,255,2790,255,2791,255,2792,255,
+255,255,255,2793,2794,255,255,2795,255,255,255,255,255,2796,2797,2798,
+2799,2800,255,2801,255,255,255,2802,2803,2804,255,2805,2806,2807,2808,255,
+255,2809,2810,2811,2812,255,255,255,2813,255,255,2814,255,255,255,255,
+255,255,255,2815,255,255,2816,2817,255,2818,2819,2820,2821,2822,2823,2824,
+2825,255,255,2826,255,255,2827,255,255,2828,255,255,2829,255,2830,2831,
+2832,255,255,255,2833,255,255,255,255,2834,2835,255,255,255,255,255,
+255,2836,2837,2838,255,2839,2840,2841,2842,255,2843,2844,255,255,255,2845,
+2846,2847,2848,255,2849,2850,255,255,2851,255,255,2852,2853,255,255,255,
+255,2854,255,255,255,2855,255,255,255,2856,255,2857,2858,2859,255,2860,
+255,255,2861,255,2862,2863,2864,2865,2866,2867,2868,255,2869,2870,2871,255,
+2872,255,2873,2874,2875,255,2876,2877,2878,2879,2880,2881,2882,255,255,2883,
+255,255,2884,2885,255,2886,2887,2888,2889,2890,255,255,2891,2892,2893,2894,
+255,2895,255,2896,2897,255,2898,2899,255,255,255,255,2900,2901,2902,2903,
+},
+{
+255,2904,2905,255,255,255,255,2906,2907,2908,255,255,255,255,2909,255,
+255,2910,255,255,255,255,2911,255,255,255,2912,2913,255,2914,2915,2916,
+2917,2918,2919,2920,2921,2922,255,255,2923,255,2924,2925,255,255,255,2926,
+255,255,2927,255,255,255,255,255,255,2928,2929,255,255,2930,255,255,
+255,255,2931,2932,255,2933,2934,255,255,2935,255,2936,2937,2938,2939,2940,
+2941,255,255,255,255,2942,255,255,255,255,255,255,255,255,2943,2944,
+255,2945,2946,2947,255,255,255,2948,255,2949,255,255,255,2950,2951,255,
+255,2952,255,255,255,255,2953,2954,255,255,2955,2956,255,255,255,255,
+2957,255,2958,255,255,255,255,2959,2960,2961,2962,255,2963,255,2964,2965,
+2966,255,2967,255,255,255,2968,255,2969,255,255,255,255,255,255,255,
+2970,255,2971,2972,255,2973,255,2974,2975,2976,2977,255,2978,2979,2980,255,
+2981,255,255,2982,2983,255,255,2984,2985,255,2986,255,2987,255,2988,255,
+255,255,255,255,2989,255,2990,255,255,2991,255,255,255,2992,2993,2994,
+2995,255,2996,255,255,255,2997,255,255,255,255,255,255,255,2998,255,
+2999,3000,255,3001,255,255,255,255,255,3002,3003,255,255,3004,255,255,
+255,255,3005,255,3006,255,3007,255,3008,255,255,255,255,3009,255,3010,
+},
+{
+3011,3012,3013,255,255,3014,255,255,255,255,255,3015,3016,255,255,3017,
+3018,255,255,3019,3020,255,255,255,255,255,255,3021,3022,255,3023,255,
+3024,3025,255,255,255,255,3026,255,255,255,3027,255,3028,3029,255,255,
+255,255,255,255,3030,255,255,255,255,255,3031,255,255,3032,255,3033,
+255,3034,255,255,3035,3036,3037,3038,3039,255,3040,255,255,255,255,255,
+255,255,3041,255,3042,255,255,255,3043,255,255,255,255,255,3044,255,
+255,255,255,255,255,255,255,3045,255,3046,255,255,255,3047,255,255,
+255,255,255,255,255,255,255,255,3048,3049,3050,255,255,255,255,255,
+255,255,3051,255,3052,3053,255,3054,255,255,255,255,255,255,255,255,
+255,3055,3056,255,255,3057,3058,255,255,3059,255,255,255,255,3060,255,
+255,255,255,255,3061,255,255,255,255,3062,255,255,3063,3064,3065,255,
+3066,255,255,255,255,3067,255,3068,3069,255,3070,255,3071,255,255,255,
+3072,255,3073,255,255,3074,255,255,255,255,255,255,255,3075,3076,255,
+3077,255,3078,255,255,255,255,3079,3080,255,255,255,255,255,3081,255,
+255,255,3082,255,3083,255,3084,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+3085,255,255,255,255,255,255,255,255,3086,255,255,255,255,255,255,
+255,255,3087,255,255,255,255,255,3088,255,255,255,255,255,255,255,
+255,255,255,255,255,3089,255,255,255,255,255,3090,255,255,3091,3092,
+255,255,255,255,3093,3094,3095,255,3096,3097,255,3098,255,255,3099,3100,
+255,255,255,255,255,3101,255,255,3102,3103,255,255,3104,255,255,3105,
+255,3106,255,255,255,3107,3108,255,255,3109,255,3110,255,3111,3112,255,
+255,255,3113,3114,255,255,3115,255,255,255,255,3116,3117,255,255,255,
+3118,255,3119,255,3120,255,255,3121,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,3122,255,255,255,3123,3124,255,255,255,
+3125,3126,255,3127,255,255,255,3128,255,3129,255,3130,3131,255,255,3132,
+255,3133,255,255,3134,3135,255,3136,255,3137,255,3138,255,3139,255,3140,
+3141,255,255,255,255,255,255,255,255,3142,255,255,3143,3144,255,255,
+255,3145,255,3146,3147,3148,3149,255,255,255,255,3150,3151,255,3152,3153,
+255,255,3154,255,255,255,3155,3156,255,255,255,255,255,255,255,255,
+3157,255,3158,255,255,3159,3160,3161,3162,3163,255,255,3164,3165,3166,3167,
+3168,3169,255,255,255,255,3170,3171,255,255,3172,255,255,255,255,255,
+},
+{
+3173,255,3174,3175,255,255,3176,255,255,255,3177,255,3178,255,3179,3180,
+255,255,255,3181,3182,3183,255,255,255,3184,255,255,255,3185,255,3186,
+3187,255,255,255,255,3188,255,3189,3190,255,255,255,255,3191,255,3192,
+255,3193,255,255,3194,3195,3196,255,255,255,255,255,3197,255,3198,255,
+255,3199,255,3200,255,255,255,255,255,255,255,3201,3202,255,255,3203,
+255,255,3204,3205,3206,3207,3208,3209,255,255,3210,255,255,255,255,3211,
+255,3212,255,255,3213,255,3214,255,3215,255,255,255,255,255,3216,3217,
+3218,255,255,255,3219,255,3220,3221,255,255,3222,255,255,255,3223,255,
+255,255,3224,255,3225,255,255,3226,255,255,255,255,3227,255,255,255,
+255,3228,255,255,255,255,3229,3230,255,255,255,255,255,3231,255,255,
+255,255,255,255,255,255,255,3232,3233,255,255,255,255,255,3234,255,
+255,255,255,255,3235,255,255,255,255,3236,255,255,255,255,3237,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,3238,255,3239,3240,3241,255,255,
+255,255,255,255,255,255,3242,255,255,3243,255,255,255,255,255,255,
+3244,255,3245,3246,3247,255,255,3248,255,3249,255,255,3250,255,3251,3252,
+},
+{
+3253,255,255,255,255,255,255,255,3254,3255,3256,3257,255,3258,255,255,
+3259,255,255,255,3260,3261,255,3262,255,255,255,3263,255,3264,255,3265,
+255,255,255,255,255,255,3266,255,3267,255,3268,3269,3270,3271,255,3272,
+255,3273,255,255,3274,3275,255,255,255,255,3276,255,255,3277,255,255,
+3278,255,3279,3280,255,255,3281,255,3282,3283,255,255,3284,255,3285,3286,
+3287,3288,255,3289,255,255,3290,255,255,255,255,255,3291,255,3292,3293,
+3294,3295,255,255,255,3296,255,255,3297,3298,3299,255,255,3300,255,3301,
+3302,255,3303,3304,255,3305,255,3306,255,255,255,255,3307,255,3308,3309,
+255,3310,255,255,3311,255,255,3312,255,3313,255,3314,255,255,255,255,
+3315,255,255,255,255,3316,255,3317,3318,255,3319,255,3320,3321,3322,255,
+255,255,3323,3324,255,3325,255,3326,3327,255,3328,3329,255,3330,255,3331,
+3332,255,255,3333,255,3334,3335,3336,3337,255,255,255,255,255,255,255,
+255,3338,255,3339,3340,255,255,255,255,255,255,255,255,255,255,3341,
+3342,3343,3344,3345,3346,255,255,255,3347,3348,3349,255,3350,3351,3352,255,
+3353,255,3354,255,255,3355,255,255,255,3356,255,255,3357,255,255,3358,
+3359,3360,255,3361,3362,255,255,255,255,255,255,255,255,3363,255,3364,
+},
+{
+3365,255,255,255,255,3366,255,3367,3368,3369,3370,3371,3372,255,3373,3374,
+255,3375,255,3376,255,255,3377,3378,255,255,255,255,255,3379,255,255,
+255,3380,255,255,255,255,255,255,255,3381,3382,255,255,255,255,255,
+255,255,3383,3384,255,255,255,3385,3386,3387,255,255,3388,3389,3390,255,
+3391,3392,3393,3394,3395,3396,3397,255,3398,3399,3400,255,3401,255,3402,255,
+3403,3404,255,3405,3406,3407,255,255,255,255,255,255,255,255,255,255,
+3408,3409,3410,3411,3412,3413,3414,3415,3416,3417,255,3418,255,255,255,255,
+255,255,255,255,3419,255,3420,3421,255,255,255,255,255,255,255,255,
+255,3422,255,3423,255,3424,3425,255,255,255,255,255,255,255,255,3426,
+255,255,255,3427,255,255,255,3428,255,255,255,255,255,255,255,255,
+255,255,3429,255,255,255,3430,3431,3432,255,255,255,255,3433,255,3434,
+3435,255,255,3436,255,3437,255,255,255,255,255,255,255,255,255,255,
+3438,255,3439,255,255,255,255,255,255,3440,255,3441,255,3442,255,255,
+255,255,3443,255,255,3444,255,255,3445,255,3446,255,255,255,255,255,
+3447,255,255,3448,255,255,255,255,255,255,255,255,255,255,3449,255,
+3450,3451,255,255,255,3452,255,255,255,3453,3454,255,3455,255,255,255,
+},
+{
+255,3456,255,255,255,3457,255,255,255,255,255,3458,255,3459,3460,255,
+3461,255,3462,255,255,255,255,255,255,255,255,255,255,255,255,3463,
+3464,255,255,255,3465,255,255,255,255,255,255,255,255,3466,255,255,
+3467,255,255,255,3468,255,255,255,255,3469,255,255,255,3470,255,3471,
+255,255,3472,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,3473,255,255,3474,255,255,3475,255,255,3476,3477,255,
+3478,255,255,3479,255,255,3480,255,255,255,255,3481,255,255,3482,255,
+255,3483,255,255,255,255,255,3484,3485,3486,255,255,3487,255,255,255,
+3488,255,3489,255,3490,255,3491,3492,3493,3494,255,255,255,3495,255,255,
+255,255,255,255,3496,3497,255,255,3498,255,255,3499,3500,255,255,255,
+255,255,255,255,255,255,255,3501,3502,255,255,3503,255,3504,255,255,
+255,3505,255,255,3506,255,255,3507,255,255,255,3508,255,255,255,255,
+255,3509,255,255,255,255,255,255,255,255,3510,255,3511,255,3512,255,
+3513,255,255,255,3514,255,255,255,255,255,255,3515,255,255,255,3516,
+3517,255,255,255,255,255,255,255,255,255,255,255,255,3518,255,255,
+255,255,3519,255,255,255,255,255,255,255,255,255,255,3520,255,3521,
+},
+{
+255,255,255,255,255,255,255,255,255,255,3522,255,255,255,255,255,
+255,255,255,255,255,255,255,3523,3524,255,255,255,255,255,255,3525,
+255,3526,255,255,255,255,255,255,3527,255,3528,255,255,255,255,3529,
+255,3530,255,255,255,3531,255,255,255,255,255,255,255,3532,3533,255,
+255,255,255,255,3534,255,255,3535,255,255,255,255,255,255,255,255,
+3536,255,255,255,255,255,255,255,3537,3538,255,3539,255,255,255,255,
+255,3540,255,255,255,3541,255,255,255,255,255,255,255,255,255,255,
+255,3542,255,255,255,255,255,255,255,3543,255,255,3544,255,255,255,
+3545,255,255,255,3546,255,255,255,255,255,255,255,255,255,3547,255,
+3548,3549,255,255,255,255,255,3550,255,255,255,255,255,255,255,255,
+3551,255,255,255,255,255,255,255,255,3552,255,3553,3554,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+3555,3556,3557,3558,3559,255,255,3560,255,255,255,255,255,255,255,255,
+255,255,3561,255,255,255,255,3562,255,3563,3564,255,255,255,3565,255,
+255,255,255,3566,255,255,3567,3568,255,3569,255,255,3570,255,255,255,
+255,255,255,255,255,255,255,255,255,3571,255,255,255,255,255,255,
+255,255,3572,3573,3574,3575,3576,3577,255,255,3578,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,3579,255,3580,3581,255,255,255,
+255,3582,3583,3584,3585,255,3586,3587,255,3588,3589,3590,255,3591,255,255,
+255,255,3592,3593,255,255,3594,255,255,255,3595,3596,255,255,255,255,
+255,3597,255,255,255,255,255,255,255,255,3598,255,255,255,255,255,
+255,255,255,3599,3600,3601,255,3602,255,255,255,255,255,255,255,3603,
+255,3604,3605,255,255,3606,255,255,255,255,255,3607,255,3608,255,3609,
+255,255,3610,3611,3612,3613,3614,3615,255,3616,255,3617,255,255,255,255,
+255,3618,255,255,255,255,255,255,255,255,3619,3620,255,255,255,3621,
+255,255,255,3622,255,3623,255,255,255,3624,255,255,255,3625,255,255,
+},
+{
+255,255,255,255,255,3626,3627,3628,255,255,255,255,255,3629,255,3630,
+3631,3632,255,3633,3634,3635,3636,255,3637,3638,3639,3640,255,255,255,3641,
+255,3642,3643,255,3644,255,3645,3646,3647,3648,3649,255,255,255,3650,3651,
+3652,255,3653,255,3654,3655,255,255,3656,255,255,255,255,3657,255,255,
+3658,3659,3660,255,255,255,3661,3662,255,3663,3664,255,255,255,255,255,
+3665,255,255,255,3666,3667,255,3668,255,255,255,3669,3670,3671,3672,3673,
+3674,3675,255,255,3676,255,255,255,3677,3678,3679,255,255,255,255,255,
+3680,255,3681,255,3682,255,3683,255,255,3684,255,255,255,3685,3686,255,
+255,3687,3688,3689,255,3690,3691,255,3692,3693,255,255,3694,255,255,3695,
+3696,255,255,3697,3698,255,255,255,255,3699,255,3700,255,255,255,3701,
+255,3702,255,3703,3704,3705,3706,3707,255,3708,3709,3710,255,3711,3712,255,
+255,3713,3714,3715,255,255,255,255,3716,3717,255,3718,3719,3720,3721,3722,
+255,255,255,255,3723,3724,255,255,255,3725,3726,255,3727,255,255,255,
+3728,255,255,3729,3730,3731,3732,3733,255,255,255,3734,255,255,3735,255,
+3736,3737,3738,3739,255,3740,255,255,3741,255,3742,3743,255,255,3744,3745,
+3746,3747,255,3748,255,3749,3750,3751,3752,255,3753,3754,3755,3756,3757,255,
+},
+{
+255,3758,255,255,3759,255,255,3760,255,255,255,3761,3762,255,3763,255,
+255,255,3764,255,255,255,255,3765,255,3766,3767,3768,255,255,3769,255,
+255,255,255,255,255,3770,255,3771,255,255,3772,3773,255,255,3774,255,
+255,3775,3776,3777,255,3778,255,255,255,3779,255,3780,3781,3782,3783,255,
+255,3784,255,3785,255,3786,3787,3788,3789,255,3790,3791,255,3792,3793,3794,
+255,3795,3796,3797,3798,255,255,255,255,3799,3800,255,3801,255,3802,255,
+3803,255,255,3804,255,255,3805,255,255,3806,3807,255,255,255,3808,3809,
+255,255,255,255,3810,255,255,3811,3812,255,255,255,3813,255,255,255,
+255,255,3814,255,255,3815,255,255,3816,3817,255,255,3818,255,3819,255,
+255,3820,255,3821,3822,3823,255,255,255,255,255,3824,255,3825,3826,3827,
+3828,3829,255,3830,3831,255,3832,3833,3834,3835,3836,3837,255,255,3838,3839,
+255,255,3840,255,255,3841,255,255,3842,255,255,255,255,255,255,3843,
+3844,255,255,255,3845,3846,3847,3848,255,255,255,3849,3850,255,255,255,
+255,3851,255,255,255,255,3852,255,3853,3854,255,255,255,3855,3856,255,
+3857,3858,255,255,3859,255,3860,255,255,255,255,3861,3862,255,3863,255,
+255,3864,255,3865,255,255,255,3866,255,3867,255,3868,3869,255,255,255,
+},
+{
+255,255,255,255,255,3870,255,255,255,255,3871,255,3872,3873,3874,255,
+3875,3876,255,255,3877,255,3878,3879,255,255,3880,255,255,3881,255,255,
+3882,3883,255,3884,3885,3886,255,255,255,3887,255,3888,255,3889,255,3890,
+255,255,3891,255,3892,255,255,255,3893,255,3894,255,255,255,255,255,
+255,255,255,3895,3896,255,255,255,255,255,255,255,255,3897,3898,255,
+255,255,255,3899,3900,255,3901,255,3902,255,255,3903,255,255,255,3904,
+255,255,255,255,255,255,255,255,255,255,255,3905,255,255,3906,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,3907,3908,
+255,255,255,3909,255,3910,3911,255,255,3912,255,255,255,255,255,3913,
+3914,255,255,255,255,255,255,255,3915,255,255,255,3916,255,255,3917,
+255,255,3918,255,255,3919,255,3920,255,255,3921,255,255,255,255,3922,
+255,3923,3924,255,3925,255,3926,3927,255,255,3928,3929,255,3930,255,255,
+255,3931,3932,255,255,255,255,3933,255,255,255,3934,255,255,255,3935,
+255,3936,255,3937,3938,3939,255,3940,255,255,3941,255,255,255,3942,3943,
+3944,3945,3946,255,3947,3948,3949,255,3950,3951,255,255,255,255,255,255,
+255,255,255,255,3952,255,255,255,255,3953,255,255,255,255,255,255,
+},
+{
+255,255,3954,255,255,255,3955,255,255,3956,255,255,255,255,255,3957,
+255,255,255,3958,3959,3960,255,255,255,255,255,255,255,255,255,255,
+3961,255,255,255,3962,255,255,255,255,3963,3964,3965,255,3966,255,3967,
+255,3968,255,3969,255,255,3970,255,255,255,255,255,255,255,3971,255,
+255,255,255,255,255,255,3972,3973,255,255,255,3974,255,3975,255,255,
+255,255,255,255,255,255,255,255,3976,255,255,255,3977,255,3978,255,
+255,255,3979,255,255,255,3980,255,255,255,255,255,255,3981,3982,255,
+255,255,3983,255,3984,255,255,255,3985,255,3986,255,3987,255,255,255,
+255,255,255,255,3988,255,255,255,3989,3990,255,255,3991,3992,3993,255,
+255,255,255,255,255,255,255,255,255,255,255,255,3994,255,255,255,
+255,3995,255,255,255,255,255,3996,255,255,255,255,255,255,255,255,
+255,255,255,3997,255,255,3998,255,255,3999,255,255,255,255,255,255,
+4000,255,4001,255,255,255,255,255,255,4002,255,255,255,255,255,255,
+255,4003,4004,255,255,255,255,255,255,255,255,255,255,255,4005,255,
+4006,4007,255,255,255,255,255,255,255,255,255,255,255,255,4008,4009,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,4010,255,255,255,255,255,255,255,255,4011,4012,255,255,255,255,
+255,255,255,4013,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,4014,255,255,255,4015,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,4016,255,255,4017,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,4018,255,
+255,255,255,255,255,255,255,255,255,255,255,4019,4020,4021,255,4022,
+4023,255,255,255,255,4024,4025,255,4026,255,255,255,4027,255,4028,4029,
+4030,255,255,255,255,4031,255,255,255,4032,4033,255,255,255,4034,255,
+255,255,4035,255,4036,4037,4038,255,255,4039,255,255,4040,4041,255,255,
+255,255,255,255,255,255,255,255,255,255,255,4042,4043,4044,4045,4046,
+255,4047,255,4048,255,255,255,4049,4050,4051,255,4052,4053,4054,255,255,
+4055,4056,4057,4058,255,255,255,255,4059,255,4060,255,255,255,255,255,
+255,255,255,255,255,255,255,255,4061,4062,255,4063,255,255,255,4064,
+255,255,255,255,4065,255,4066,4067,4068,4069,255,4070,4071,4072,255,4073,
+255,255,255,255,255,255,255,4074,255,4075,255,255,255,4076,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,4077,4078,255,255,255,255,255,
+4079,255,255,4080,255,4081,4082,255,4083,4084,4085,255,255,255,255,255,
+255,255,255,255,255,255,4086,255,255,255,255,255,255,255,255,4087,
+4088,4089,255,255,255,255,4090,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,4091,255,255,255,255,4092,255,4093,255,4094,255,
+255,255,255,255,255,255,255,255,255,255,255,255,4095,255,4096,255,
+255,255,255,255,4097,255,4098,4099,4100,255,255,255,255,255,4101,255,
+255,255,4102,4103,255,255,255,255,4104,255,4105,255,255,4106,255,255,
+255,255,255,255,4107,255,255,255,255,255,4108,255,255,255,255,4109,
+255,255,255,255,4110,255,255,255,4111,4112,255,255,255,255,255,4113,
+4114,255,255,255,255,255,255,255,4115,255,255,255,4116,255,255,255,
+255,255,255,4117,255,4118,255,255,255,4119,255,255,255,255,255,255,
+255,255,255,4120,255,255,255,255,255,255,255,255,255,255,4121,255,
+255,255,255,255,4122,4123,255,255,255,255,255,255,255,255,255,255,
+4124,255,255,255,255,4125,255,4126,255,255,255,255,255,255,4127,255,
+255,255,255,255,255,255,255,255,255,4128,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,4129,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,4130,255,255,
+255,255,255,255,255,255,255,255,4131,255,4132,255,4133,255,255,255,
+4134,4135,255,255,255,4136,4137,4138,4139,4140,255,4141,255,4142,255,4143,
+255,255,255,255,255,255,255,4144,4145,255,255,255,4146,4147,255,255,
+255,255,4148,255,255,255,4149,255,255,4150,255,4151,255,4152,255,4153,
+255,4154,4155,255,255,255,4156,4157,255,4158,255,255,255,255,4159,4160,
+255,255,4161,255,255,4162,255,255,255,4163,4164,255,255,255,4165,4166,
+4167,4168,255,255,4169,255,255,255,255,255,4170,4171,255,4172,255,4173,
+255,255,4174,255,255,255,255,255,255,255,255,255,255,255,255,4175,
+255,255,255,255,255,255,255,255,255,255,255,255,4176,4177,255,4178,
+4179,255,255,255,4180,255,4181,4182,4183,4184,255,255,255,255,255,255,
+255,4185,4186,4187,4188,255,255,255,4189,255,255,255,255,4190,4191,255,
+4192,255,4193,255,255,255,255,4194,255,4195,255,255,255,255,4196,255,
+4197,4198,255,255,255,255,255,255,4199,4200,255,255,4201,4202,4203,4204,
+4205,4206,4207,4208,4209,255,255,4210,4211,255,4212,4213,4214,255,255,255,
+},
+{
+255,4215,255,4216,255,255,255,255,255,255,4217,255,255,255,4218,255,
+255,255,255,4219,255,4220,4221,4222,255,255,255,4223,4224,4225,4226,255,
+255,4227,4228,255,255,4229,255,255,255,4230,4231,4232,4233,255,4234,255,
+255,4235,255,255,4236,255,255,4237,4238,4239,255,255,255,255,4240,4241,
+255,255,255,255,255,255,255,255,255,255,255,255,255,4242,255,255,
+4243,255,4244,255,255,255,255,4245,255,255,255,255,255,255,255,255,
+4246,255,255,255,255,255,255,255,255,255,255,255,4247,4248,255,4249,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,4250,255,
+255,255,255,255,4251,255,255,4252,255,4253,255,4254,255,255,4255,255,
+255,4256,255,255,255,255,4257,255,255,255,255,4258,255,255,255,4259,
+255,255,4260,255,255,255,255,255,255,4261,255,4262,255,255,4263,4264,
+4265,255,4266,4267,255,255,255,4268,255,255,4269,4270,255,255,255,255,
+4271,255,4272,255,255,255,255,255,4273,4274,4275,255,255,4276,255,4277,
+4278,4279,255,255,255,255,255,255,255,4280,255,255,255,255,4281,255,
+4282,255,255,255,255,4283,255,4284,255,4285,255,255,255,4286,255,255,
+255,255,4287,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,4288,255,4289,4290,255,255,4291,4292,255,255,255,255,4293,
+4294,255,255,255,255,255,255,255,255,255,4295,4296,255,255,255,255,
+255,255,4297,255,255,4298,4299,255,4300,255,4301,255,4302,255,4303,255,
+4304,255,255,4305,4306,4307,4308,255,255,255,255,255,4309,255,255,255,
+255,4310,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,4311,255,4312,255,4313,4314,4315,4316,255,4317,4318,
+255,255,255,255,255,255,255,255,255,255,255,255,255,4319,255,255,
+4320,255,255,255,255,255,4321,4322,255,255,255,255,255,255,4323,255,
+4324,4325,255,4326,255,255,255,4327,255,255,255,4328,255,255,4329,255,
+4330,255,255,255,255,255,255,255,255,255,255,255,4331,255,4332,255,
+255,255,255,255,255,255,255,4333,4334,4335,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,4336,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,4337,255,255,255,255,255,255,255,255,255,4338,255,4339,255,
+4340,255,4341,4342,4343,255,4344,255,255,255,255,255,255,255,4345,4346,
+255,255,255,255,4347,255,4348,4349,255,255,255,255,255,255,255,4350,
+},
+{
+255,255,255,255,4351,255,255,255,255,255,255,255,255,4352,255,4353,
+255,4354,255,4355,255,255,255,255,4356,4357,4358,255,4359,255,255,4360,
+255,255,255,255,255,4361,255,255,4362,4363,255,4364,4365,4366,255,4367,
+4368,4369,4370,4371,255,4372,255,4373,4374,255,4375,4376,255,255,4377,255,
+4378,255,255,255,255,4379,255,255,4380,255,255,4381,4382,255,4383,4384,
+255,255,255,255,4385,255,255,255,255,4386,4387,4388,4389,255,255,255,
+255,255,255,255,255,4390,4391,255,255,255,4392,255,255,255,255,255,
+255,255,4393,255,4394,255,255,255,4395,4396,255,255,255,255,255,4397,
+255,255,255,4398,255,255,4399,255,255,255,255,4400,255,255,255,4401,
+255,4402,4403,255,4404,255,4405,4406,255,4407,4408,255,255,4409,255,4410,
+4411,4412,255,4413,4414,4415,255,255,255,255,255,4416,4417,255,4418,4419,
+4420,4421,4422,4423,4424,4425,255,255,4426,4427,255,255,4428,4429,4430,255,
+255,255,4431,4432,4433,4434,255,4435,4436,4437,4438,255,255,4439,255,255,
+255,255,4440,255,4441,4442,4443,255,4444,255,255,4445,255,255,4446,255,
+255,255,4447,4448,4449,255,4450,4451,4452,255,4453,4454,255,255,255,255,
+4455,4456,255,255,4457,255,255,255,255,4458,255,255,4459,255,255,4460,
+},
+{
+4461,4462,255,4463,255,4464,255,255,255,255,4465,255,4466,255,255,255,
+4467,255,255,255,255,4468,255,4469,4470,4471,255,4472,255,255,255,4473,
+4474,255,4475,255,4476,4477,4478,255,255,4479,4480,4481,255,4482,255,255,
+4483,255,255,4484,4485,4486,255,255,4487,255,255,255,4488,255,4489,4490,
+4491,255,255,4492,255,255,255,255,255,255,255,255,4493,4494,255,255,
+255,255,255,255,4495,255,4496,255,255,255,255,255,4497,255,4498,255,
+255,255,255,4499,255,255,255,255,255,255,255,4500,255,255,255,4501,
+255,255,255,255,255,255,255,255,4502,255,255,4503,255,4504,4505,255,
+255,255,4506,255,4507,255,4508,4509,4510,255,255,4511,255,255,4512,255,
+255,4513,255,4514,255,255,4515,255,255,4516,255,255,255,255,255,255,
+255,255,255,255,4517,255,255,255,255,255,255,255,255,255,4518,255,
+255,4519,4520,255,4521,255,255,255,255,255,255,255,255,255,255,4522,
+255,255,4523,255,255,4524,4525,255,4526,255,4527,255,255,4528,4529,4530,
+4531,4532,4533,255,4534,255,4535,4536,4537,255,255,4538,255,255,255,4539,
+255,255,255,255,255,4540,255,255,255,255,255,255,255,255,4541,4542,
+255,4543,4544,255,4545,255,255,255,4546,4547,255,255,4548,255,4549,255,
+},
+{
+255,4550,255,255,4551,255,255,4552,4553,4554,255,4555,255,4556,255,255,
+255,255,255,255,255,255,255,255,255,4557,4558,255,255,255,255,4559,
+4560,255,4561,255,255,255,4562,255,4563,4564,255,255,255,4565,255,4566,
+255,255,255,255,255,4567,4568,4569,4570,255,4571,255,4572,255,255,255,
+4573,4574,255,4575,255,255,255,4576,255,255,255,255,255,255,255,255,
+4577,4578,255,255,255,255,255,255,255,255,4579,4580,255,255,255,255,
+255,4581,4582,4583,255,4584,4585,255,4586,255,255,4587,4588,255,255,255,
+255,255,255,255,255,255,255,255,255,4589,255,255,255,4590,4591,4592,
+4593,255,255,255,4594,4595,255,255,255,255,255,255,4596,4597,4598,255,
+255,4599,4600,255,255,255,255,255,255,255,255,255,255,255,255,4601,
+4602,255,4603,255,255,4604,255,4605,255,4606,4607,255,4608,255,255,255,
+4609,255,255,4610,255,4611,255,255,255,255,255,4612,255,4613,255,4614,
+255,255,255,255,255,255,255,255,255,255,255,255,255,4615,255,255,
+255,255,255,255,255,255,255,4616,255,255,255,4617,4618,255,255,255,
+255,255,4619,4620,255,4621,255,4622,255,4623,255,4624,4625,4626,4627,255,
+255,255,255,4628,255,255,4629,255,4630,255,255,255,255,4631,4632,4633,
+},
+{
+4634,4635,4636,255,255,255,255,255,255,4637,255,255,4638,4639,255,255,
+255,4640,4641,255,4642,255,4643,4644,4645,255,4646,255,4647,4648,255,4649,
+255,255,255,4650,255,4651,4652,4653,255,4654,255,255,4655,4656,255,255,
+4657,255,255,255,4658,255,255,4659,4660,4661,4662,4663,4664,255,4665,255,
+4666,255,255,255,255,4667,255,4668,255,255,255,255,4669,255,4670,255,
+4671,255,4672,255,255,4673,4674,4675,255,255,255,255,255,4676,255,255,
+255,255,255,255,255,255,255,255,255,255,4677,4678,4679,4680,4681,255,
+255,255,255,255,255,255,255,4682,255,255,255,255,4683,255,255,255,
+255,255,255,255,255,255,255,4684,255,4685,255,255,4686,4687,4688,255,
+255,4689,255,4690,255,255,255,4691,4692,255,4693,4694,4695,255,255,4696,
+255,4697,255,4698,255,4699,255,4700,255,255,255,255,255,255,255,255,
+4701,4702,4703,4704,4705,255,255,255,255,4706,255,255,255,255,4707,255,
+255,4708,255,255,255,4709,255,255,255,4710,4711,4712,255,255,255,255,
+4713,255,255,255,4714,4715,255,255,255,4716,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,4717,255,255,255,4718,255,255,255,
+255,255,4719,255,4720,255,255,4721,255,255,4722,255,255,255,255,255,
+},
+{
+255,4723,255,255,255,4724,255,255,255,255,255,255,255,255,255,255,
+255,255,255,4725,255,255,255,255,255,255,255,255,255,255,4726,255,
+255,255,255,255,4727,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,4728,255,255,255,255,255,4729,4730,4731,255,4732,255,
+4733,4734,255,255,255,255,4735,255,4736,4737,255,255,255,255,255,255,
+255,255,255,4738,255,255,4739,4740,255,255,4741,4742,4743,4744,4745,4746,
+4747,255,4748,255,255,4749,255,4750,4751,255,255,255,255,4752,255,4753,
+255,255,255,255,255,255,255,4754,4755,255,4756,255,255,255,255,255,
+4757,4758,255,255,4759,4760,255,255,255,255,4761,255,255,255,255,4762,
+255,255,255,255,255,255,255,255,255,255,4763,255,255,255,255,255,
+255,255,255,255,255,255,255,4764,255,255,255,255,255,255,255,255,
+255,255,255,4765,255,255,255,255,255,4766,4767,4768,255,4769,4770,255,
+4771,4772,255,4773,255,255,4774,255,255,4775,255,4776,255,4777,255,255,
+255,4778,4779,255,255,4780,255,255,4781,255,255,255,255,255,255,4782,
+255,255,255,4783,4784,255,4785,4786,255,4787,255,4788,255,4789,255,4790,
+4791,255,255,255,255,255,255,255,4792,255,255,4793,255,4794,255,255,
+},
+{
+4795,255,4796,4797,255,255,4798,255,255,255,255,4799,255,4800,4801,255,
+255,255,255,255,4802,255,255,4803,255,255,4804,255,255,255,4805,255,
+4806,255,255,4807,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,4808,255,255,255,4809,255,4810,255,4811,4812,4813,255,4814,
+255,255,255,255,255,255,4815,255,255,255,255,255,255,255,255,255,
+255,4816,255,255,255,255,255,4817,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+4818,255,255,255,4819,255,4820,4821,4822,4823,4824,255,255,255,255,4825,
+4826,4827,255,4828,4829,255,4830,255,4831,255,255,255,255,4832,255,255,
+255,4833,4834,255,255,4835,4836,4837,4838,255,255,255,4839,4840,255,4841,
+4842,255,255,255,255,4843,4844,255,4845,255,255,255,4846,4847,255,255,
+255,255,255,4848,255,255,255,255,255,255,255,255,255,255,255,4849,
+255,255,255,255,255,255,255,255,255,255,255,4850,255,255,255,255,
+255,255,255,255,255,255,4851,255,255,4852,255,255,255,255,4853,4854,
+4855,255,255,4856,255,4857,4858,255,255,255,255,255,255,4859,255,4860,
+255,255,255,255,255,255,255,255,255,4861,4862,255,255,4863,255,4864,
+},
+{
+255,255,255,4865,4866,255,4867,255,4868,255,4869,4870,255,255,255,4871,
+255,4872,255,255,4873,4874,255,255,255,4875,255,4876,255,255,4877,255,
+4878,255,255,255,4879,4880,4881,255,4882,255,4883,4884,4885,255,4886,255,
+255,4887,255,4888,255,255,255,255,4889,255,4890,255,4891,255,4892,255,
+255,255,255,255,255,4893,255,4894,255,4895,255,4896,4897,255,255,4898,
+4899,4900,4901,255,4902,255,4903,255,4904,255,4905,4906,255,4907,255,255,
+4908,255,4909,255,255,255,255,255,255,255,255,255,255,255,4910,255,
+255,4911,4912,255,255,4913,255,4914,255,4915,255,4916,255,255,4917,255,
+4918,255,255,255,255,4919,255,255,255,255,255,255,255,4920,255,255,
+4921,255,255,255,4922,4923,255,4924,255,255,255,255,4925,4926,255,255,
+255,4927,4928,255,255,255,4929,4930,4931,4932,4933,4934,4935,4936,255,255,
+255,4937,255,255,4938,255,255,255,4939,255,255,255,255,255,255,255,
+255,4940,255,255,255,255,4941,4942,255,255,255,255,4943,255,255,255,
+255,4944,255,4945,255,255,255,255,255,4946,4947,255,255,4948,255,255,
+255,4949,255,255,255,4950,4951,255,255,255,4952,255,255,255,4953,255,
+255,4954,255,255,255,255,255,4955,255,255,255,255,4956,255,4957,255,
+},
+{
+255,255,255,255,255,255,255,4958,255,255,255,4959,4960,255,255,4961,
+255,255,255,255,255,255,4962,255,255,255,255,255,255,255,255,4963,
+255,255,255,255,255,255,4964,4965,255,255,4966,255,255,255,255,255,
+255,255,255,255,255,255,255,255,4967,255,255,255,255,255,255,4968,
+4969,4970,255,255,255,255,255,255,255,255,255,255,255,4971,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,4972,4973,255,255,255,255,255,255,4974,4975,4976,255,255,
+255,255,255,255,255,255,255,255,255,4977,255,255,255,255,255,255,
+255,4978,4979,255,255,4980,255,4981,4982,255,255,255,4983,4984,4985,4986,
+255,255,4987,255,4988,4989,255,255,255,255,4990,255,255,255,4991,255,
+255,4992,4993,4994,255,255,255,255,255,4995,255,255,4996,4997,4998,255,
+255,4999,255,255,255,5000,255,5001,5002,255,5003,255,5004,5005,255,255,
+255,255,255,255,255,5006,5007,5008,255,5009,255,255,5010,255,255,5011,
+5012,255,255,255,255,255,255,255,5013,255,255,255,255,255,255,5014,
+255,255,255,255,255,255,255,255,5015,255,255,5016,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,5017,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+5018,255,5019,255,255,255,255,5020,255,255,255,5021,255,255,255,5022,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,5023,255,
+255,255,255,255,255,255,255,5024,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,5025,255,255,255,255,255,255,255,5026,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,5027,255,255,255,255,
+255,5028,255,255,255,255,255,5029,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,5030,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,5031,255,255,255,5032,
+5033,5034,5035,5036,5037,5038,5039,5040,5041,5042,5043,5044,5045,5046,255,5047,
+5048,5049,5050,5051,255,5052,5053,5054,5055,5056,5057,255,255,5058,5059,5060,
+5061,5062,5063,5064,5065,5066,5067,5068,5069,5070,5071,5072,5073,5074,5075,5076,
+5077,5078,5079,5080,5081,5082,255,5083,5084,5085,5086,5087,5088,5089,5090,5091,
+5092,5093,5094,5095,255,5096,5097,5098,5099,5100,5101,5102,255,5103,5104,5105,
+5106,5107,5108,5109,5110,5111,5112,5113,5114,255,5115,5116,5117,5118,5119,5120,
+},
+{
+5121,5122,5123,5124,5125,5126,5127,5128,5129,5130,255,5131,5132,5133,5134,5135,
+255,5136,5137,5138,5139,5140,5141,5142,5143,5144,5145,5146,5147,5148,255,5149,
+5150,5151,5152,5153,5154,5155,5156,5157,5158,5159,5160,5161,5162,5163,5164,5165,
+5166,5167,5168,5169,5170,5171,5172,255,5173,255,5174,255,255,255,255,255,
+255,255,5175,255,5176,5177,255,255,255,255,255,255,255,255,255,255,
+5178,5179,255,255,5180,5181,255,5182,5183,255,5184,255,255,255,255,5185,
+255,5186,5187,255,255,255,255,255,5188,5189,5190,255,255,255,5191,255,
+255,5192,5193,255,5194,255,255,255,255,5195,255,255,255,255,5196,255,
+255,5197,255,255,255,255,255,255,255,255,5198,255,5199,255,5200,255,
+255,255,255,255,5201,255,255,255,255,255,5202,255,255,5203,5204,5205,
+255,5206,255,255,5207,255,255,5208,255,255,255,255,255,255,255,5209,
+5210,255,5211,255,255,255,255,255,5212,5213,255,255,5214,5215,255,5216,
+255,5217,255,255,255,5218,255,255,255,255,5219,255,5220,255,5221,255,
+255,255,255,255,5222,5223,255,255,5224,255,255,255,255,255,255,5225,
+5226,5227,255,255,255,5228,5229,255,255,5230,255,255,255,255,5231,255,
+5232,5233,255,5234,255,255,255,255,255,255,255,5235,5236,255,255,255,
+},
+{
+5237,5238,255,5239,5240,5241,5242,255,255,255,255,5243,5244,5245,255,255,
+5246,255,5247,255,5248,5249,5250,5251,5252,5253,255,255,5254,255,255,255,
+5255,255,5256,255,255,5257,5258,5259,5260,5261,5262,255,255,255,255,255,
+255,5263,255,5264,255,5265,5266,5267,5268,255,255,5269,255,5270,255,5271,
+255,255,5272,5273,255,255,5274,255,255,255,5275,5276,5277,5278,255,255,
+255,255,5279,255,5280,255,255,255,5281,255,5282,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,5283,5284,255,255,255,255,255,
+255,5285,255,255,255,255,255,255,255,255,255,255,255,255,255,5286,
+5287,255,255,5288,5289,255,5290,5291,255,5292,255,5293,5294,255,255,255,
+255,255,255,5295,255,255,5296,255,5297,255,5298,5299,5300,5301,255,5302,
+5303,5304,5305,255,5306,5307,255,255,255,5308,5309,5310,255,5311,5312,5313,
+255,5314,5315,255,5316,255,255,5317,255,255,5318,255,5319,5320,5321,5322,
+5323,5324,5325,5326,5327,255,5328,255,255,255,255,255,5329,5330,5331,255,
+255,255,255,255,255,255,5332,5333,255,5334,5335,5336,5337,5338,5339,255,
+255,5340,255,255,5341,5342,255,5343,5344,5345,5346,5347,5348,5349,255,5350,
+5351,5352,5353,5354,5355,255,5356,255,5357,255,5358,255,5359,5360,255,255,
+},
+{
+255,255,5361,255,255,255,5362,255,255,5363,5364,255,255,5365,5366,5367,
+5368,5369,5370,5371,5372,255,5373,255,5374,255,5375,255,255,255,5376,255,
+255,255,255,255,255,255,255,255,255,255,255,255,5377,255,255,5378,
+255,5379,5380,255,255,255,5381,255,5382,255,255,255,255,255,5383,255,
+255,255,255,255,255,255,5384,255,5385,255,5386,5387,5388,255,255,255,
+5389,5390,255,5391,5392,5393,255,255,255,5394,5395,255,255,255,255,255,
+5396,255,255,255,255,5397,255,5398,255,5399,255,255,255,5400,5401,255,
+5402,5403,255,255,5404,255,255,255,255,5405,5406,5407,5408,5409,5410,5411,
+5412,255,5413,255,255,255,255,255,5414,255,5415,255,255,255,255,5416,
+255,5417,255,255,255,255,255,255,5418,255,255,5419,5420,5421,255,255,
+255,255,255,5422,255,255,5423,255,5424,255,5425,255,255,255,255,255,
+255,255,255,5426,255,255,255,255,255,255,5427,5428,255,255,255,255,
+5429,5430,5431,5432,255,255,5433,255,255,255,5434,255,5435,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,5436,255,255,255,5437,255,255,5438,255,5439,5440,255,255,
+255,255,255,5441,5442,255,255,255,255,255,255,5443,5444,255,5445,255,
+},
+{
+5446,5447,5448,255,5449,5450,5451,255,255,255,255,255,5452,5453,255,255,
+5454,255,5455,255,5456,255,255,255,255,255,255,5457,5458,255,5459,5460,
+255,5461,5462,5463,255,255,255,255,5464,255,5465,5466,5467,5468,255,5469,
+5470,5471,255,5472,5473,5474,5475,5476,5477,5478,255,5479,255,255,5480,255,
+255,255,255,255,5481,255,255,5482,255,5483,255,5484,255,255,255,5485,
+255,255,255,255,255,255,255,255,5486,255,5487,255,255,255,255,5488,
+255,255,255,255,255,255,255,255,5489,255,255,255,255,255,5490,5491,
+5492,255,5493,5494,5495,255,255,255,255,5496,5497,255,255,5498,5499,5500,
+255,255,5501,255,5502,255,255,255,5503,255,5504,5505,255,5506,5507,5508,
+255,5509,5510,255,255,255,255,5511,5512,5513,255,255,5514,5515,255,5516,
+255,5517,255,255,5518,5519,5520,255,5521,5522,5523,5524,5525,5526,5527,5528,
+5529,5530,255,5531,5532,255,255,5533,5534,5535,255,255,255,5536,5537,255,
+255,5538,255,255,5539,255,255,5540,5541,255,5542,5543,5544,5545,5546,5547,
+255,5548,5549,5550,5551,5552,255,5553,5554,255,255,5555,5556,255,5557,5558,
+5559,5560,255,5561,5562,5563,5564,255,255,255,255,5565,255,255,255,5566,
+255,5567,255,255,5568,255,255,5569,255,5570,255,5571,255,255,255,255,
+},
+{
+255,5572,5573,5574,5575,5576,5577,5578,5579,5580,255,255,5581,255,5582,5583,
+255,5584,255,255,5585,5586,255,5587,255,255,5588,5589,5590,255,255,255,
+255,255,255,255,255,255,255,5591,5592,255,255,5593,5594,5595,255,5596,
+255,5597,255,5598,5599,5600,5601,255,5602,5603,5604,255,5605,255,255,255,
+5606,255,255,5607,255,255,5608,5609,255,5610,255,255,255,255,255,5611,
+5612,5613,5614,255,5615,255,255,255,255,255,5616,5617,5618,255,5619,5620,
+5621,5622,255,5623,5624,5625,5626,5627,5628,5629,5630,5631,5632,5633,5634,5635,
+255,255,255,255,255,255,255,5636,5637,255,255,5638,5639,5640,255,255,
+255,255,255,255,255,5641,5642,255,255,5643,255,255,255,255,5644,255,
+255,255,5645,5646,255,255,255,255,5647,255,255,5648,5649,255,5650,255,
+5651,255,255,255,255,255,255,255,5652,5653,5654,5655,255,255,255,255,
+5656,5657,5658,5659,5660,255,5661,5662,5663,5664,5665,255,5666,5667,255,255,
+5668,5669,255,255,255,5670,255,5671,255,255,5672,255,5673,255,255,5674,
+255,255,255,255,5675,255,5676,255,5677,255,255,255,5678,5679,255,5680,
+5681,5682,255,255,255,5683,255,255,255,5684,5685,255,255,255,255,255,
+5686,5687,5688,255,255,255,255,255,5689,5690,255,255,255,5691,255,255,
+},
+{
+255,5692,255,5693,5694,255,5695,255,255,255,255,5696,5697,5698,5699,5700,
+255,5701,255,255,255,255,255,255,5702,255,255,255,5703,5704,255,255,
+255,255,255,255,5705,5706,5707,5708,5709,255,255,255,255,255,255,255,
+255,5710,255,255,255,255,255,255,5711,255,255,255,5712,5713,255,255,
+255,255,255,255,255,255,5714,255,255,255,255,255,255,255,255,255,
+255,5715,255,255,255,255,255,5716,255,5717,5718,5719,5720,255,255,255,
+255,5721,255,5722,255,255,255,255,255,5723,255,5724,5725,5726,255,255,
+255,5727,255,5728,255,5729,5730,255,5731,255,5732,255,255,255,255,255,
+255,255,5733,255,255,255,255,5734,5735,5736,255,5737,5738,255,5739,255,
+255,255,255,255,255,255,255,5740,255,5741,255,255,5742,255,255,255,
+255,5743,255,255,255,255,255,255,255,255,255,255,255,255,255,5744,
+255,255,5745,255,5746,255,255,255,5747,5748,5749,255,255,5750,255,5751,
+255,5752,255,255,5753,255,255,255,255,5754,5755,255,255,5756,255,255,
+5757,5758,255,5759,255,255,5760,255,255,255,255,255,255,5761,255,5762,
+5763,255,255,5764,255,5765,5766,255,255,255,255,255,5767,255,255,255,
+5768,255,255,255,255,255,255,255,255,255,255,255,5769,255,255,5770,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,5771,255,255,255,
+255,5772,255,5773,255,255,255,5774,255,255,5775,255,255,255,255,5776,
+255,5777,255,255,255,255,255,255,255,255,255,5778,5779,255,255,255,
+255,255,255,255,255,255,255,5780,5781,5782,5783,5784,5785,5786,255,255,
+255,255,255,5787,255,255,255,255,5788,5789,5790,255,255,255,255,255,
+255,255,255,255,255,255,5791,255,255,5792,255,255,255,255,5793,255,
+255,255,255,255,5794,255,255,255,5795,255,255,255,255,255,255,255,
+255,255,5796,255,5797,255,255,255,255,5798,5799,5800,255,255,5801,255,
+255,255,255,255,5802,5803,255,5804,255,255,255,255,255,255,255,5805,
+255,255,255,255,255,255,255,255,255,255,255,5806,5807,255,255,255,
+255,255,255,255,5808,255,255,255,5809,255,5810,255,255,255,5811,5812,
+5813,255,255,255,255,255,255,5814,255,5815,255,255,255,255,255,255,
+255,5816,255,255,255,255,255,255,255,5817,255,255,255,255,255,5818,
+5819,255,255,5820,255,5821,255,255,255,255,255,255,5822,255,255,255,
+255,255,255,255,5823,255,255,255,255,5824,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,5825,255,255,255,5826,
+},
+{
+255,255,255,255,255,5827,255,255,255,255,255,255,255,255,255,255,
+255,5828,255,255,255,255,5829,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,5830,255,5831,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,5832,255,255,255,5833,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,5834,5835,5836,
+5837,5838,255,255,5839,255,255,255,255,255,5840,255,255,255,5841,255,
+255,255,5842,255,255,255,255,255,255,255,255,5843,5844,255,5845,255,
+255,5846,255,255,255,255,255,255,255,5847,5848,5849,5850,5851,5852,5853,
+5854,5855,5856,255,255,255,255,255,255,255,5857,5858,5859,5860,255,255,
+255,255,255,5861,255,5862,255,255,255,255,255,255,5863,5864,255,255,
+255,255,255,5865,5866,255,255,5867,5868,5869,5870,255,5871,255,255,5872,
+5873,5874,255,255,5875,5876,5877,255,255,255,5878,255,255,255,255,255,
+5879,255,255,255,5880,255,5881,5882,255,5883,5884,5885,255,255,5886,5887,
+5888,5889,255,255,5890,255,255,255,5891,5892,255,5893,255,255,5894,5895,
+255,255,255,255,5896,255,255,255,255,5897,255,255,255,5898,5899,255,
+5900,5901,5902,5903,5904,255,255,255,5905,5906,255,255,255,255,5907,255,
+},
+{
+5908,255,5909,5910,255,255,255,5911,5912,5913,5914,255,255,5915,255,255,
+255,255,5916,5917,255,5918,255,5919,5920,255,5921,255,5922,255,5923,255,
+255,5924,5925,5926,255,5927,255,255,255,5928,255,255,255,255,5929,255,
+255,5930,255,255,5931,255,255,5932,255,255,255,5933,255,255,5934,5935,
+255,255,255,255,255,255,255,5936,5937,5938,255,255,5939,255,5940,255,
+255,255,255,5941,255,255,255,5942,255,5943,255,255,255,255,255,255,
+5944,255,255,5945,5946,5947,255,255,255,255,255,255,255,255,5948,255,
+5949,255,255,255,5950,255,5951,255,255,255,255,5952,5953,5954,5955,255,
+255,255,5956,5957,255,5958,255,255,5959,255,255,5960,255,5961,255,255,
+255,255,255,5962,255,255,255,5963,255,255,255,255,255,255,255,5964,
+255,255,255,255,255,255,255,255,5965,255,255,5966,5967,5968,255,5969,
+255,255,255,5970,255,5971,255,255,255,255,5972,255,255,5973,255,255,
+5974,255,255,255,255,255,5975,255,255,255,5976,5977,255,255,255,255,
+255,5978,5979,5980,255,255,255,255,255,255,255,5981,255,255,255,255,
+5982,255,255,255,255,5983,255,255,255,255,5984,255,255,255,5985,255,
+255,255,255,255,255,255,255,255,255,5986,255,255,255,255,5987,255,
+},
+{
+255,255,255,5988,255,255,255,255,255,255,5989,255,255,255,255,255,
+255,255,255,5990,255,5991,5992,255,255,255,255,5993,255,255,255,255,
+255,5994,5995,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,5996,255,255,255,255,255,255,5997,255,255,5998,255,255,255,
+5999,255,255,255,6000,6001,255,255,255,255,255,255,6002,6003,255,255,
+255,255,255,255,6004,255,255,6005,255,6006,255,255,255,255,255,255,
+255,6007,6008,6009,6010,6011,255,255,6012,6013,255,6014,6015,255,6016,255,
+6017,255,6018,255,255,255,255,6019,255,255,255,255,255,6020,6021,6022,
+255,6023,6024,255,6025,6026,255,255,6027,255,255,6028,255,6029,255,255,
+255,255,6030,255,255,255,6031,255,255,255,255,255,6032,255,255,255,
+255,255,6033,255,6034,255,255,255,255,255,255,6035,255,6036,255,255,
+255,6037,255,255,255,255,255,6038,255,255,255,255,6039,255,255,255,
+255,6040,6041,255,255,6042,6043,255,255,6044,255,255,255,255,6045,255,
+255,255,6046,255,6047,6048,255,255,6049,6050,255,255,255,255,255,6051,
+255,255,6052,6053,6054,6055,255,255,6056,255,255,255,255,255,255,255,
+6057,6058,255,6059,6060,255,255,255,6061,6062,255,255,6063,255,6064,255,
+},
+{
+255,255,6065,255,255,255,255,255,255,255,6066,255,255,255,255,255,
+6067,255,6068,6069,255,255,255,255,255,6070,6071,6072,255,255,255,255,
+255,6073,255,255,255,6074,255,255,255,255,6075,6076,255,255,255,255,
+6077,255,255,255,6078,255,6079,255,255,255,255,255,255,255,255,255,
+255,6080,255,255,6081,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6082,6083,
+255,255,255,255,255,255,6084,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,6085,255,255,255,6086,
+255,6087,255,6088,255,255,6089,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,6090,6091,255,6092,6093,6094,6095,6096,6097,6098,6099,6100,255,6101,6102,
+6103,6104,6105,255,255,255,6106,255,255,255,6107,255,6108,255,6109,255,
+255,255,255,6110,255,6111,6112,255,255,255,255,6113,255,255,255,6114,
+255,255,255,6115,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+6116,255,255,255,255,255,255,6117,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6118,255,
+255,255,255,255,255,255,255,255,6119,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,6120,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,6121,6122,255,255,255,255,255,
+255,255,255,6123,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,6124,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,6125,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,6126,255,255,255,255,255,6127,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+6128,6129,6130,6131,6132,6133,6134,6135,6136,6137,6138,6139,255,6140,6141,6142,
+6143,255,6144,6145,6146,6147,6148,6149,6150,6151,6152,255,6153,6154,6155,6156,
+6157,6158,6159,6160,6161,6162,6163,255,6164,6165,6166,6167,6168,6169,6170,6171,
+255,6172,6173,6174,6175,6176,6177,6178,6179,6180,6181,6182,6183,6184,6185,6186,
+6187,6188,6189,6190,6191,6192,6193,6194,6195,6196,255,6197,6198,6199,6200,6201,
+6202,6203,6204,6205,6206,6207,6208,6209,6210,6211,6212,6213,6214,6215,6216,6217,
+},
+{
+6218,6219,6220,6221,6222,6223,6224,6225,6226,255,6227,6228,6229,6230,6231,6232,
+6233,6234,6235,6236,6237,6238,6239,6240,6241,6242,6243,6244,6245,6246,255,6247,
+6248,6249,6250,6251,6252,6253,6254,6255,6256,6257,6258,6259,6260,6261,6262,6263,
+6264,6265,6266,6267,6268,6269,6270,6271,255,255,255,255,255,255,255,255,
+255,6272,255,255,255,255,6273,6274,255,6275,255,255,6276,255,255,255,
+255,255,255,255,255,6277,255,255,255,255,6278,255,255,255,255,255,
+255,6279,6280,255,255,255,255,255,255,255,6281,6282,255,255,255,255,
+255,255,255,6283,255,255,255,255,6284,6285,6286,255,255,255,255,255,
+255,255,6287,255,255,6288,255,255,255,6289,6290,255,6291,255,255,255,
+255,255,255,255,6292,255,255,255,6293,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,6294,6295,6296,
+255,6297,6298,6299,6300,6301,6302,6303,6304,6305,6306,6307,6308,6309,6310,6311,
+6312,6313,6314,6315,6316,6317,6318,6319,6320,6321,6322,6323,6324,6325,6326,6327,
+6328,6329,6330,6331,6332,6333,6334,6335,6336,6337,6338,6339,6340,6341,6342,6343,
+6344,255,255,6345,6346,6347,6348,255,6349,6350,6351,6352,6353,6354,6355,255,
+6356,6357,6358,6359,6360,255,6361,6362,255,255,255,6363,255,6364,255,255,
+6365,255,255,6366,6367,6368,6369,6370,255,255,255,255,255,255,255,255,
+255,6371,255,255,6372,6373,255,255,255,255,6374,6375,255,255,255,255,
+255,6376,255,255,6377,255,255,255,255,255,255,255,255,255,255,6378,
+255,255,255,6379,255,255,255,255,255,255,255,255,255,255,255,255,
+255,6380,255,6381,6382,6383,255,255,6384,255,6385,255,6386,255,6387,6388,
+255,255,255,6389,6390,255,6391,255,255,255,255,6392,6393,255,6394,6395,
+255,6396,255,255,255,255,6397,6398,255,255,6399,6400,255,6401,6402,6403,
+255,255,255,6404,6405,255,255,255,6406,255,6407,6408,6409,255,255,6410,
+255,255,255,6411,255,6412,255,6413,6414,6415,6416,6417,255,6418,255,255,
+},
+{
+255,255,255,255,255,6419,255,255,255,6420,6421,255,6422,255,255,6423,
+255,255,255,255,6424,255,255,255,255,255,255,255,255,6425,6426,6427,
+255,255,6428,6429,255,255,255,255,255,6430,6431,255,6432,255,6433,6434,
+255,6435,255,255,255,6436,255,255,255,6437,6438,255,255,6439,255,255,
+6440,6441,6442,255,6443,255,255,6444,6445,6446,6447,6448,255,255,255,255,
+255,6449,6450,255,255,255,255,255,255,6451,255,255,255,255,255,255,
+255,255,255,255,255,255,6452,255,255,6453,255,255,6454,6455,255,6456,
+6457,255,6458,255,6459,255,6460,255,255,255,255,255,6461,255,255,6462,
+255,6463,255,255,255,6464,255,6465,255,255,255,255,255,255,255,6466,
+6467,255,255,255,6468,255,255,255,255,255,255,255,6469,255,6470,255,
+255,255,255,255,255,255,255,255,255,255,255,6471,6472,255,255,6473,
+255,255,6474,255,255,255,255,255,255,255,6475,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6476,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,6477,6478,6479,6480,255,6481,6482,6483,6484,6485,
+6486,6487,6488,6489,6490,6491,6492,6493,6494,6495,6496,6497,6498,6499,6500,6501,
+255,6502,6503,6504,6505,6506,6507,6508,6509,6510,6511,6512,255,6513,6514,6515,
+6516,6517,255,6518,6519,6520,6521,6522,6523,6524,6525,6526,6527,255,6528,6529,
+255,255,255,6530,255,255,255,255,6531,6532,255,6533,255,255,255,255,
+6534,6535,255,255,255,255,6536,255,255,6537,255,255,255,6538,6539,255,
+255,6540,6541,255,6542,6543,255,6544,6545,255,255,255,255,255,6546,255,
+6547,6548,255,6549,6550,6551,255,255,6552,6553,255,6554,6555,6556,6557,6558,
+255,255,6559,255,6560,6561,6562,255,6563,6564,6565,6566,255,6567,6568,255,
+6569,255,255,6570,255,255,255,6571,6572,6573,255,255,255,6574,255,255,
+},
+{
+6575,6576,6577,6578,6579,6580,6581,255,255,6582,6583,6584,255,6585,255,6586,
+6587,6588,6589,255,6590,255,6591,6592,255,255,6593,6594,255,6595,6596,6597,
+6598,6599,6600,255,255,255,6601,255,255,255,255,255,255,6602,6603,6604,
+255,255,255,255,255,6605,6606,255,6607,255,255,6608,6609,255,6610,255,
+255,6611,6612,255,6613,255,255,6614,255,255,255,255,255,6615,255,6616,
+6617,6618,6619,6620,255,255,255,6621,6622,255,255,6623,255,255,255,255,
+255,255,6624,6625,255,6626,255,255,6627,255,255,255,255,6628,6629,255,
+255,255,255,255,6630,6631,255,255,255,255,255,255,255,6632,255,6633,
+6634,255,6635,6636,255,255,255,255,6637,255,255,6638,255,255,255,255,
+255,6639,255,6640,255,6641,255,6642,255,6643,255,6644,255,6645,255,255,
+255,6646,6647,6648,255,255,6649,255,255,255,6650,255,6651,255,6652,6653,
+6654,6655,255,6656,6657,6658,6659,255,6660,6661,6662,6663,255,255,6664,255,
+255,6665,255,255,6666,6667,255,6668,255,255,6669,255,255,255,6670,6671,
+6672,6673,255,6674,255,255,255,6675,255,255,255,6676,6677,6678,255,255,
+255,6679,6680,255,255,255,6681,6682,6683,255,255,6684,255,6685,255,6686,
+255,255,255,255,6687,255,255,255,6688,255,255,255,255,6689,6690,255,
+},
+{
+255,255,6691,255,6692,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,6693,255,255,255,255,6694,255,
+255,255,6695,6696,255,255,255,255,255,255,255,255,255,255,255,6697,
+255,6698,255,255,255,255,255,255,255,6699,255,255,255,255,255,255,
+255,255,255,6700,255,255,6701,255,255,6702,6703,6704,6705,6706,6707,6708,
+6709,255,6710,255,255,255,255,6711,255,255,6712,255,255,6713,6714,255,
+255,6715,6716,6717,6718,6719,255,255,255,6720,6721,255,6722,255,6723,6724,
+6725,6726,6727,255,6728,6729,6730,6731,6732,6733,255,255,255,6734,6735,6736,
+255,255,255,255,255,6737,255,6738,255,6739,255,6740,6741,6742,255,255,
+6743,6744,6745,255,255,255,255,255,255,255,6746,6747,255,255,255,255,
+255,255,6748,6749,255,255,255,255,255,255,6750,255,255,6751,6752,6753,
+255,255,255,255,6754,6755,255,255,255,255,6756,255,255,255,255,255,
+255,255,255,255,255,255,255,6757,255,6758,6759,255,6760,6761,6762,6763,
+255,6764,255,255,255,255,255,255,255,255,255,255,6765,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,6766,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6767,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6768,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,6769,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6770,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,6771,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,6772,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,6773,255,255,255,255,255,
+255,255,255,255,255,255,6774,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,6775,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,6776,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,6777,6778,6779,6780,6781,6782,6783,6784,6785,6786,6787,
+6788,255,6789,6790,6791,6792,255,6793,255,6794,6795,6796,6797,6798,6799,6800,
+6801,6802,6803,6804,6805,6806,6807,6808,6809,6810,6811,6812,6813,6814,6815,6816,
+6817,6818,6819,6820,6821,6822,6823,6824,6825,6826,6827,6828,6829,6830,6831,6832,
+6833,6834,6835,6836,6837,6838,6839,255,6840,6841,6842,6843,6844,6845,6846,255,
+6847,6848,6849,255,255,6850,6851,6852,6853,6854,255,6855,6856,6857,6858,6859,
+6860,6861,6862,6863,6864,6865,255,6866,6867,6868,6869,6870,6871,6872,6873,6874,
+6875,6876,6877,6878,6879,6880,6881,6882,6883,6884,6885,255,6886,6887,6888,6889,
+},
+{
+6890,6891,6892,6893,6894,6895,6896,6897,6898,6899,6900,6901,6902,6903,6904,6905,
+6906,6907,6908,6909,6910,6911,6912,6913,6914,6915,6916,6917,255,6918,6919,6920,
+255,6921,6922,6923,6924,6925,6926,255,6927,6928,6929,6930,6931,6932,6933,6934,
+6935,6936,6937,255,6938,6939,6940,6941,6942,6943,6944,6945,6946,255,6947,6948,
+6949,6950,6951,255,6952,6953,6954,6955,255,6956,6957,255,6958,6959,6960,6961,
+6962,6963,6964,6965,6966,255,6967,6968,6969,6970,255,6971,6972,6973,6974,6975,
+255,6976,6977,6978,6979,6980,6981,6982,6983,6984,6985,6986,6987,6988,255,6989,
+6990,6991,6992,6993,255,255,6994,255,255,255,255,255,255,255,255,6995,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,6996,6997,6998,6999,255,7000,7001,7002,
+7003,7004,7005,7006,7007,7008,7009,7010,7011,7012,7013,7014,7015,7016,7017,255,
+},
+{
+7018,7019,7020,7021,7022,7023,7024,255,7025,7026,7027,7028,7029,7030,7031,7032,
+7033,7034,7035,255,7036,7037,7038,7039,255,7040,7041,255,7042,7043,255,7044,
+255,7045,7046,255,255,255,255,255,255,255,7047,255,255,255,7048,255,
+255,7049,7050,7051,7052,7053,7054,255,255,255,255,7055,7056,7057,255,7058,
+7059,255,7060,255,7061,7062,7063,7064,7065,7066,255,7067,7068,7069,255,255,
+7070,255,255,255,7071,7072,255,255,255,255,255,7073,255,255,255,7074,
+255,7075,7076,255,7077,255,255,7078,7079,7080,7081,255,7082,255,255,255,
+255,255,7083,255,7084,7085,7086,7087,255,255,255,255,255,255,255,255,
+255,255,255,255,255,7088,7089,255,7090,255,255,7091,255,7092,255,7093,
+7094,255,255,255,7095,255,255,7096,7097,7098,255,255,7099,255,255,255,
+255,255,255,255,255,255,255,7100,255,255,255,255,255,255,255,255,
+7101,255,255,7102,255,255,7103,255,255,7104,255,255,7105,7106,7107,255,
+7108,7109,255,255,7110,7111,7112,7113,255,7114,255,255,7115,7116,7117,7118,
+255,255,7119,255,255,7120,255,255,255,255,255,255,255,255,255,255,
+7121,255,255,255,255,255,255,255,7122,7123,7124,255,255,255,255,7125,
+255,255,255,7126,255,255,7127,7128,255,7129,255,255,255,255,7130,255,
+},
+{
+7131,7132,255,255,7133,255,7134,7135,7136,7137,255,255,255,7138,7139,7140,
+255,255,255,7141,255,255,7142,255,255,255,255,255,7143,255,7144,255,
+255,255,255,255,255,255,255,255,255,255,7145,255,255,7146,255,255,
+7147,255,7148,255,255,255,255,255,7149,7150,255,255,255,255,7151,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,7152,7153,255,255,7154,255,255,7155,255,7156,255,255,7157,255,
+7158,7159,7160,255,255,7161,255,255,255,7162,255,255,255,255,255,255,
+255,255,255,7163,7164,255,7165,255,255,255,255,255,7166,255,255,255,
+255,255,255,255,255,7167,255,255,255,255,255,7168,255,7169,255,255,
+255,7170,7171,255,7172,255,255,255,7173,255,255,255,255,255,255,255,
+7174,255,255,7175,255,255,255,255,255,255,255,7176,255,7177,255,7178,
+255,255,7179,255,7180,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,7181,7182,255,7183,7184,7185,7186,7187,255,255,
+255,255,255,7188,255,7189,7190,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,7191,7192,7193,7194,7195,7196,7197,7198,7199,7200,7201,
+7202,7203,7204,7205,7206,7207,7208,7209,7210,7211,7212,255,7213,7214,255,7215,
+7216,7217,255,7218,7219,255,7220,7221,7222,255,7223,7224,7225,7226,7227,7228,
+7229,7230,7231,255,7232,7233,7234,7235,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,7236,255,
+255,7237,7238,7239,255,7240,255,255,7241,7242,7243,255,255,255,7244,7245,
+255,255,255,255,255,255,255,7246,7247,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,7248,255,255,
+7249,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,7250,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,7251,7252,255,255,255,255,255,255,255,255,255,255,
+255,255,255,7253,255,7254,255,7255,7256,7257,7258,7259,7260,7261,7262,7263,
+7264,7265,7266,255,7267,7268,7269,7270,255,255,7271,255,7272,7273,255,7274,
+7275,7276,255,255,7277,7278,7279,7280,7281,255,7282,7283,255,7284,255,7285,
+7286,7287,7288,7289,7290,7291,7292,7293,7294,7295,255,255,255,255,255,255,
+255,255,255,255,255,7296,255,255,7297,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,7298,7299,7300,7301,
+7302,7303,255,7304,7305,7306,7307,7308,7309,7310,7311,7312,7313,7314,7315,7316,
+7317,7318,7319,255,7320,7321,7322,7323,7324,255,7325,7326,7327,255,255,7328,
+7329,7330,7331,7332,255,255,7333,7334,7335,255,7336,7337,7338,7339,7340,7341,
+7342,7343,7344,7345,7346,7347,255,7348,7349,255,255,255,255,255,255,255,
+7350,7351,255,255,255,255,7352,7353,7354,255,7355,255,7356,255,255,255,
+7357,7358,7359,255,255,7360,255,255,255,255,255,7361,7362,255,255,255,
+255,7363,255,7364,255,255,255,255,7365,255,255,255,255,255,255,7366,
+255,7367,255,255,255,255,7368,255,255,255,255,7369,255,7370,255,7371,
+255,255,255,255,255,255,255,255,255,7372,255,7373,255,255,255,255,
+},
+{
+255,255,255,7374,255,255,255,255,7375,255,255,255,255,255,255,7376,
+255,255,255,7377,255,255,255,255,255,255,255,255,255,255,255,7378,
+255,255,255,7379,255,255,255,255,255,255,255,255,255,255,255,7380,
+255,255,7381,255,255,255,255,255,255,255,255,7382,7383,255,255,255,
+255,7384,7385,7386,7387,7388,255,7389,7390,7391,255,255,255,7392,255,7393,
+255,7394,255,255,7395,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,7396,255,255,7397,
+255,7398,7399,255,255,7400,7401,7402,7403,255,255,7404,255,7405,7406,255,
+7407,7408,7409,255,7410,7411,255,255,255,255,7412,7413,7414,255,7415,7416,
+7417,7418,7419,7420,7421,7422,7423,7424,7425,7426,255,7427,255,7428,7429,255,
+7430,7431,7432,7433,7434,7435,7436,7437,7438,255,7439,7440,7441,7442,255,255,
+255,255,255,7443,7444,7445,7446,7447,255,255,7448,7449,7450,7451,7452,7453,
+7454,255,255,7455,7456,7457,7458,7459,7460,7461,255,255,7462,7463,7464,7465,
+255,255,7466,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7467,
+7468,7469,7470,7471,255,7472,7473,255,7474,7475,7476,7477,7478,7479,255,7480,
+255,7481,7482,7483,255,7484,7485,7486,7487,7488,7489,255,255,7490,7491,7492,
+255,7493,7494,7495,7496,7497,7498,7499,7500,7501,7502,7503,7504,255,7505,7506,
+255,7507,255,255,255,7508,255,7509,7510,255,7511,7512,7513,255,7514,255,
+255,255,255,7515,7516,255,7517,7518,7519,7520,7521,7522,7523,7524,255,255,
+7525,7526,255,7527,255,255,255,255,255,255,255,255,255,255,7528,7529,
+255,255,7530,255,255,255,255,7531,7532,255,255,7533,255,255,255,255,
+255,255,7534,7535,255,255,255,255,255,255,255,255,255,7536,255,7537,
+255,255,255,255,255,255,7538,255,255,255,255,255,255,255,255,255,
+255,255,255,255,7539,255,255,255,7540,255,255,7541,255,7542,7543,255,
+255,255,255,255,7544,255,255,255,255,7545,255,255,255,7546,7547,7548,
+255,7549,255,255,7550,255,255,255,7551,255,255,7552,7553,7554,255,7555,
+7556,255,7557,255,255,7558,255,7559,255,7560,7561,255,255,255,255,7562,
+255,255,255,255,255,255,255,255,255,7563,255,7564,7565,255,7566,255,
+},
+{
+255,255,255,255,255,255,255,255,255,255,255,7567,255,7568,7569,255,
+7570,255,255,7571,255,255,255,7572,255,7573,255,255,255,255,255,255,
+7574,255,7575,255,255,255,255,255,255,255,255,255,7576,255,255,7577,
+255,255,255,255,255,255,255,7578,255,7579,255,7580,255,7581,7582,255,
+255,255,255,255,7583,255,255,255,255,255,255,255,255,255,255,255,
+7584,7585,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,7586,
+7587,255,255,7588,7589,7590,7591,7592,7593,7594,7595,7596,7597,255,255,255,
+255,255,255,255,255,255,255,255,255,7598,7599,7600,255,255,255,7601,
+7602,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+{
+255,7603,7604,7605,7606,7607,7608,7609,7610,7611,7612,7613,7614,7615,7616,7617,
+7618,7619,7620,7621,7622,7623,7624,7625,7626,7627,7628,7629,7630,7631,7632,7633,
+7634,7635,7636,7637,7638,7639,7640,7641,7642,7643,7644,7645,7646,7647,7648,7649,
+7650,7651,7652,7653,7654,7655,7656,7657,7658,7659,7660,7661,7662,7663,7664,7665,
+7666,7667,7668,7669,7670,7671,7672,7673,7674,7675,7676,7677,7678,7679,7680,7681,
+7682,7683,7684,7685,7686,7687,7688,7689,7690,7691,7692,7693,7694,7695,7696,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+7697,7698,255,7699,255,7700,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+},
+};